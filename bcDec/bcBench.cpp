@@ -0,0 +1,715 @@
+// Decoder benchmark. Generates a synthetic corpus of obfuscated dumps and
+// times the decoder on it, end to end and per kernel. The corpus depends
+// only on the options and the seed, so runs are comparable across builds.
+#include <stdio.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iterator>
+#include <chrono>
+#include <algorithm>
+
+#include "lua.h"
+#include "lauxlib.h"
+#include "lj_arch.h"
+#include "lj_obj.h"
+#include "lj_str.h"
+#include "lj_bc.h"
+#include "lj_bcdump.h"
+
+#include "bcCore.h"
+
+
+struct BenchOptions
+{
+	unsigned files = 200;
+	unsigned protos = 20;     // Functions per file, besides the main chunk.
+	unsigned strings = 8;     // String constants per function.
+	unsigned str_len = 24;    // Average string length.
+	unsigned tables = 2;      // Template tables per function.
+	bool debug = false;       // Unstripped dumps: chunk name and empty debug sections.
+	unsigned seed = 1;
+	unsigned rounds = 5;
+	std::string out_dir;      // Only write the corpus there.
+	std::string tmp_dir = "bcbench.tmp";
+};
+
+static BenchOptions g_Bench;
+
+
+class BenchRng
+{
+public:
+	explicit BenchRng(uint64_t _seed) : s(_seed * 0x9E3779B97F4A7C15ull + 1) {}
+
+	uint32_t next()
+	{
+		s ^= s << 13;
+		s ^= s >> 7;
+		s ^= s << 17;
+		return (uint32_t)(s >> 16);
+	}
+
+	uint32_t range(uint32_t _lo, uint32_t _hi)
+	{
+		return _lo + next() % (_hi - _lo + 1);
+	}
+
+private:
+	uint64_t s;
+};
+
+static std::string random_string(BenchRng& _rng, unsigned _avg)
+{
+	static const char chars[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_ ";
+	unsigned len = _rng.range(_avg / 2 + 1, _avg + _avg / 2 + 1);
+	std::string s(len, ' ');
+	for (unsigned i = 0; i < len; ++i)
+	{
+		s[i] = chars[_rng.next() % (sizeof(chars) - 1)];
+	}
+	return s;
+}
+
+// Lua source for one file. Every function gets its own string constants
+// and constant tables, which end up as template tables in the dump.
+static std::string make_source(BenchRng& _rng)
+{
+	std::string src = "local M = {}\n";
+	char line[128];
+	for (unsigned f = 0; f < g_Bench.protos; ++f)
+	{
+		snprintf(line, sizeof(line), "M.f%u = function(a, b)\n", f);
+		src += line;
+		for (unsigned i = 0; i < g_Bench.strings; ++i)
+		{
+			src += "\ta = a .. \"" + random_string(_rng, g_Bench.str_len) + "\"\n";
+		}
+		for (unsigned i = 0; i < g_Bench.tables; ++i)
+		{
+			snprintf(line, sizeof(line), "\tb = { id = %u, scale = %u.25, ok = true, %u, %u, ",
+				_rng.next() % 100000, _rng.next() % 1000, _rng.next() % 1000, _rng.next() % 1000);
+			src += line;
+			src += "name = \"" + random_string(_rng, g_Bench.str_len) + "\", \"" + random_string(_rng, 8) + "\" }\n";
+		}
+		snprintf(line, sizeof(line), "\treturn a, b, %u.5\nend\n", f);
+		src += line;
+	}
+	src += "return M\n";
+	return src;
+}
+
+static int writer_vec(lua_State* L, const void* p, size_t size, void* ud)
+{
+	std::vector<char>* out = (std::vector<char>*)ud;
+	out->insert(out->end(), (const char*)p, (const char*)p + size);
+	UNUSED(L);
+	return 0;
+}
+
+// Compiles source into a stripped standard dump.
+static bool compile_dump(lua_State* L, const std::string& _src, std::vector<char>& _out)
+{
+	if (luaL_loadbuffer(L, _src.data(), _src.size(), "=bench") != 0)
+	{
+		fprintf(stderr, "bcBench: %s\n", lua_tostring(L, -1));
+		lua_settop(L, 0);
+		return false;
+	}
+	_out.clear();
+	int status = lj_bcwrite(L, funcproto(funcV(L->top - 1)), writer_vec, &_out, 1);
+	lua_settop(L, 0);
+	return status == 0;
+}
+
+
+// Rewrites a stripped standard dump into the obfuscated format, the
+// inverse of lj_bctrans_mod().
+class BenchObfuscator
+{
+public:
+	BenchObfuscator()
+	{
+		const uint8_t* op_map = lj_bcopmap_mod();
+		for (int i = 0; i < BC__MAX; ++i)
+		{
+			inv_map[op_map[i]] = (uint8_t)i;
+		}
+	}
+
+	bool run(const std::vector<char>& _in, std::vector<char>& _out)
+	{
+		p = (const uint8_t*)_in.data();
+		pe = p + _in.size();
+		ok = true;
+		_out.clear();
+		const uint8_t* h = mem(4);
+		if (!ok || h[0] != BCDUMP_HEAD1 || h[1] != BCDUMP_HEAD2 || h[2] != BCDUMP_HEAD3)
+		{
+			return false;
+		}
+		_out.insert(_out.end(), (const char*)h, (const char*)h + 4);
+		uint32_t flags = uleb();
+		if (!(flags & BCDUMP_F_STRIP))
+		{
+			return false;
+		}
+		if (g_Bench.debug)
+		{
+			static const char chunkname[] = "=bench";
+			put_uleb(_out, flags & ~BCDUMP_F_STRIP);
+			put_uleb(_out, sizeof(chunkname) - 1);
+			_out.insert(_out.end(), chunkname, chunkname + sizeof(chunkname) - 1);
+		}
+		else
+		{
+			put_uleb(_out, flags);
+		}
+		std::vector<char> pt;
+		for (;;)
+		{
+			uint32_t len = uleb();
+			if (!ok || len == 0)
+			{
+				break;
+			}
+			if (len > (size_t)(pe - p))
+			{
+				return false;
+			}
+			const uint8_t* end = p + len;
+			if (!proto(pt) || p != end)
+			{
+				return false;
+			}
+			put_uleb(_out, (uint32_t)pt.size());
+			_out.insert(_out.end(), pt.begin(), pt.end());
+		}
+		put_uleb(_out, 0);
+		return ok && p == pe;
+	}
+
+private:
+	bool proto(std::vector<char>& _out)
+	{
+		_out.clear();
+		const uint8_t* h = mem(4);
+		if (!ok)
+		{
+			return false;
+		}
+		uint8_t flags = h[0], numparams = h[1], framesize = h[2], sizeuv = h[3];
+		uint32_t sizekgc = uleb(), sizekn = uleb(), sizebc = uleb();
+		_out.push_back((char)framesize);
+		_out.push_back((char)(flags ^ framesize));
+		_out.push_back((char)(numparams ^ flags));
+		_out.push_back((char)(sizeuv ^ numparams));
+		put_uleb(_out, sizekn);
+		put_uleb(_out, sizekgc);
+		put_uleb(_out, sizebc);
+		if (g_Bench.debug)
+		{
+			put_uleb(_out, 0);
+		}
+		const uint8_t* bc = mem((size_t)sizebc * 4);
+		if (!ok)
+		{
+			return false;
+		}
+		for (uint32_t i = 0; i < sizebc; ++i, bc += 4)
+		{
+			if (bc[0] >= BC__MAX)
+			{
+				return false;
+			}
+			_out.push_back((char)inv_map[bc[0]]);
+			_out.push_back((char)~bc[1]);
+			_out.push_back((char)bc[2]);
+			_out.push_back((char)(bc[3] ^ i));
+		}
+		copy(_out, (size_t)sizeuv * 2);
+		// Number constants come first here, the standard dump has them last.
+		std::vector<char> kgc;
+		for (uint32_t i = 0; i < sizekgc && ok; ++i)
+		{
+			uint32_t tp = uleb();
+			put_uleb(kgc, tp);
+			if (tp >= BCDUMP_KGC_STR)
+			{
+				put_str(kgc, tp - BCDUMP_KGC_STR);
+			}
+			else if (tp == BCDUMP_KGC_TAB)
+			{
+				uint32_t narray = uleb(), nhash = uleb();
+				put_uleb(kgc, nhash);
+				put_uleb(kgc, narray);
+				for (uint32_t j = 0; j < narray + nhash * 2 && ok; ++j)
+				{
+					ktabk(kgc);
+				}
+			}
+			else if (tp != BCDUMP_KGC_CHILD)
+			{
+				for (int n = tp == BCDUMP_KGC_COMPLEX ? 4 : 2; n > 0; --n)
+				{
+					copy_uleb(kgc);
+				}
+			}
+		}
+		for (uint32_t i = 0; i < sizekn && ok; ++i)
+		{
+			bool isnum = p < pe && (*p & 1);
+			copy_uleb(_out);
+			if (isnum)
+			{
+				copy_uleb(_out);
+			}
+		}
+		_out.insert(_out.end(), kgc.begin(), kgc.end());
+		return ok;
+	}
+
+	void ktabk(std::vector<char>& _out)
+	{
+		uint32_t tp = uleb();
+		put_uleb(_out, tp);
+		if (tp >= BCDUMP_KTAB_STR)
+		{
+			put_str(_out, tp - BCDUMP_KTAB_STR);
+		}
+		else if (tp == BCDUMP_KTAB_INT)
+		{
+			copy_uleb(_out);
+		}
+		else if (tp == BCDUMP_KTAB_NUM)
+		{
+			copy_uleb(_out);
+			copy_uleb(_out);
+		}
+	}
+
+	const uint8_t* mem(size_t _n)
+	{
+		if ((size_t)(pe - p) < _n)
+		{
+			ok = false;
+			return nullptr;
+		}
+		const uint8_t* r = p;
+		p += _n;
+		return r;
+	}
+
+	uint32_t uleb()
+	{
+		uint32_t v = 0;
+		for (int sh = 0; ok; sh += 7)
+		{
+			const uint8_t* b = mem(1);
+			if (!b || sh > 28)
+			{
+				ok = false;
+				break;
+			}
+			v |= (uint32_t)(*b & 0x7f) << sh;
+			if (*b < 0x80)
+			{
+				break;
+			}
+		}
+		return v;
+	}
+
+	void copy_uleb(std::vector<char>& _out)
+	{
+		const uint8_t* b = p;
+		uleb();
+		_out.insert(_out.end(), (const char*)b, (const char*)p);
+	}
+
+	void copy(std::vector<char>& _out, size_t _n)
+	{
+		const uint8_t* b = mem(_n);
+		if (b)
+		{
+			_out.insert(_out.end(), (const char*)b, (const char*)b + _n);
+		}
+	}
+
+	// Encodes so that the reader's ~(p[i] ^ i) gives the string back.
+	void put_str(std::vector<char>& _out, size_t _n)
+	{
+		const uint8_t* b = mem(_n);
+		for (size_t i = 0; b && i < _n; ++i)
+		{
+			_out.push_back((char)(uint8_t)(~b[i] ^ i));
+		}
+	}
+
+	static void put_uleb(std::vector<char>& _out, uint32_t _v)
+	{
+		for (; _v >= 0x80; _v >>= 7)
+		{
+			_out.push_back((char)((_v & 0x7f) | 0x80));
+		}
+		_out.push_back((char)_v);
+	}
+
+	uint8_t inv_map[BC__MAX];
+	const uint8_t* p = nullptr;
+	const uint8_t* pe = nullptr;
+	bool ok = true;
+};
+
+
+struct BenchCorpus
+{
+	std::vector<std::vector<char>> dumps;
+	size_t bytes = 0;
+};
+
+static bool make_corpus(BenchCorpus& _corpus)
+{
+	lua_State* L = luaL_newstate();
+	BenchRng rng(g_Bench.seed);
+	BenchObfuscator obf;
+	std::vector<char> std_dump;
+	std::vector<char> check;
+	for (unsigned i = 0; i < g_Bench.files; ++i)
+	{
+		std::vector<char> dump;
+		if (!compile_dump(L, make_source(rng), std_dump) || !obf.run(std_dump, dump))
+		{
+			fprintf(stderr, "bcBench: cannot generate file %u\n", i);
+			lua_close(L);
+			return false;
+		}
+		// The transcoder must give back the original dump.
+		check.resize(dump.size());
+		size_t n = lj_bctrans_mod(dump.data(), dump.size(), check.data());
+		if (n == 0 || (!g_Bench.debug && (n != std_dump.size() || memcmp(check.data(), std_dump.data(), n) != 0)))
+		{
+			fprintf(stderr, "bcBench: generated file %u does not round trip\n", i);
+			lua_close(L);
+			return false;
+		}
+		_corpus.bytes += dump.size();
+		_corpus.dumps.push_back(std::move(dump));
+	}
+	lua_close(L);
+	return true;
+}
+
+
+static bool make_dir(const std::string& _path)
+{
+#ifdef _WIN32
+	return _mkdir(_path.c_str()) == 0 || errno == EEXIST;
+#else
+	return mkdir(_path.c_str(), 0755) == 0 || errno == EEXIST;
+#endif
+}
+
+static void remove_dir(const std::string& _path)
+{
+#ifdef _WIN32
+	_rmdir(_path.c_str());
+#else
+	rmdir(_path.c_str());
+#endif
+}
+
+static std::string corpus_path(const std::string& _dir, unsigned _i)
+{
+	char name[32];
+	snprintf(name, sizeof(name), "/bench_%05u.lua.bytes", _i);
+	return _dir + name;
+}
+
+static bool write_file(const std::string& _path, const char* _data, size_t _size)
+{
+	std::ofstream ofs(_path.c_str(), std::ios::binary | std::ios::trunc);
+	ofs.write(_data, (std::streamsize)_size);
+	ofs.close();
+	return !ofs.fail();
+}
+
+static bool write_corpus(const BenchCorpus& _corpus, const std::string& _dir)
+{
+	if (!make_dir(_dir))
+	{
+		return false;
+	}
+	for (size_t i = 0; i < _corpus.dumps.size(); ++i)
+	{
+		const std::vector<char>& d = _corpus.dumps[i];
+		if (!write_file(corpus_path(_dir, (unsigned)i), d.data(), d.size()))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+
+typedef std::chrono::steady_clock BenchClock;
+
+static double seconds_since(BenchClock::time_point _begin)
+{
+	return std::chrono::duration<double>(BenchClock::now() - _begin).count();
+}
+
+// Prints one result. Times are the best of all rounds.
+static void report(const char* _name, double _seconds, double _bytes, double _items, const char* _unit)
+{
+	double secs = _seconds > 0.0 ? _seconds : 1e-9;
+	printf("%-22s %10.4f s %10.2f MB/s %12.0f %s/s\n", _name, _seconds, _bytes / 1048576.0 / secs, _items / secs, _unit);
+}
+
+static int sink_vec(void* ud, const void* p, size_t n)
+{
+	std::vector<char>* out = (std::vector<char>*)ud;
+	out->insert(out->end(), (const char*)p, (const char*)p + n);
+	return 0;
+}
+
+static void bench_strdec()
+{
+	BenchRng rng(g_Bench.seed);
+	std::vector<std::string> strs;
+	size_t bytes = 0;
+	while (bytes < (4u << 20))
+	{
+		strs.push_back(random_string(rng, g_Bench.str_len));
+		bytes += strs.back().size();
+	}
+	lj_bcstrdec_init();
+	std::vector<uint8_t> out(g_Bench.str_len * 2 + 2);
+	double best = 1e30;
+	for (unsigned r = 0; r < g_Bench.rounds; ++r)
+	{
+		auto begin = BenchClock::now();
+		for (size_t i = 0; i < strs.size(); ++i)
+		{
+			lj_bcstrdec_mod(out.data(), (const uint8_t*)strs[i].data(), (MSize)strs[i].size());
+		}
+		best = std::min(best, seconds_since(begin));
+	}
+	report("strdec kernel", best, (double)bytes, (double)strs.size(), "strings");
+}
+
+static void bench_str_new()
+{
+	BenchRng rng(g_Bench.seed + 1);
+	std::vector<std::string> strs;
+	size_t bytes = 0;
+	for (unsigned i = 0; i < 200000; ++i)
+	{
+		strs.push_back(random_string(rng, g_Bench.str_len));
+		bytes += strs.back().size();
+	}
+	double best_new = 1e30, best_hit = 1e30;
+	for (unsigned r = 0; r < g_Bench.rounds; ++r)
+	{
+		lua_State* L = luaL_newstate();
+		lua_gc(L, LUA_GCSTOP, 0);
+		auto begin = BenchClock::now();
+		for (size_t i = 0; i < strs.size(); ++i)
+		{
+			lj_str_new(L, strs[i].data(), strs[i].size());
+		}
+		best_new = std::min(best_new, seconds_since(begin));
+		begin = BenchClock::now();
+		for (size_t i = 0; i < strs.size(); ++i)
+		{
+			lj_str_new(L, strs[i].data(), strs[i].size());
+		}
+		best_hit = std::min(best_hit, seconds_since(begin));
+		lua_close(L);
+	}
+	report("lj_str_new (new)", best_new, (double)bytes, (double)strs.size(), "strings");
+	report("lj_str_new (interned)", best_hit, (double)bytes, (double)strs.size(), "strings");
+}
+
+static void bench_decode(const BenchCorpus& _corpus, const char* _name, int _transcode)
+{
+	bcdec_ctx* ctx = bcdec_new();
+	bcdec_opts opts = {};
+	opts.transcode = _transcode;
+	std::vector<char> out;
+	double best = 1e30;
+	for (unsigned r = 0; r < g_Bench.rounds; ++r)
+	{
+		auto begin = BenchClock::now();
+		for (size_t i = 0; i < _corpus.dumps.size(); ++i)
+		{
+			const std::vector<char>& d = _corpus.dumps[i];
+			out.clear();
+			bcdec_sink sink = {};
+			sink.write = sink_vec;
+			sink.ud = &out;
+			if (bcdec_decode(ctx, d.data(), d.size(), &sink, &opts) != BCDEC_OK)
+			{
+				fprintf(stderr, "bcBench: decode failed: %s\n", bcdec_errmsg(ctx));
+				bcdec_free(ctx);
+				return;
+			}
+		}
+		best = std::min(best, seconds_since(begin));
+	}
+	bcdec_free(ctx);
+	report(_name, best, (double)_corpus.bytes, (double)_corpus.dumps.size(), "files");
+}
+
+// Read, decode and write every file through the file system, like bcDec.
+static void bench_end_to_end(const BenchCorpus& _corpus)
+{
+	std::string in_dir = g_Bench.tmp_dir;
+	std::string out_dir = in_dir + "/dec";
+	if (!write_corpus(_corpus, in_dir) || !make_dir(out_dir))
+	{
+		fprintf(stderr, "bcBench: cannot write %s\n", in_dir.c_str());
+		return;
+	}
+	bcdec_ctx* ctx = bcdec_new();
+	std::vector<char> in, out;
+	double best = 1e30, best_read = 0.0, best_decode = 0.0, best_write = 0.0;
+	for (unsigned r = 0; r < g_Bench.rounds; ++r)
+	{
+		double t_read = 0.0, t_decode = 0.0, t_write = 0.0;
+		for (size_t i = 0; i < _corpus.dumps.size(); ++i)
+		{
+			auto begin = BenchClock::now();
+			std::ifstream ifs(corpus_path(in_dir, (unsigned)i).c_str(), std::ios::binary);
+			in.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+			t_read += seconds_since(begin);
+			begin = BenchClock::now();
+			out.clear();
+			bcdec_sink sink = {};
+			sink.write = sink_vec;
+			sink.ud = &out;
+			bcdec_decode(ctx, in.data(), in.size(), &sink, nullptr);
+			t_decode += seconds_since(begin);
+			begin = BenchClock::now();
+			write_file(corpus_path(out_dir, (unsigned)i), out.data(), out.size());
+			t_write += seconds_since(begin);
+		}
+		double total = t_read + t_decode + t_write;
+		if (total < best)
+		{
+			best = total;
+			best_read = t_read;
+			best_decode = t_decode;
+			best_write = t_write;
+		}
+	}
+	bcdec_free(ctx);
+	double bytes = (double)_corpus.bytes, files = (double)_corpus.dumps.size();
+	report("end to end", best, bytes, files, "files");
+	report("  read", best_read, bytes, files, "files");
+	report("  decode", best_decode, bytes, files, "files");
+	report("  write", best_write, bytes, files, "files");
+	for (size_t i = 0; i < _corpus.dumps.size(); ++i)
+	{
+		::remove(corpus_path(out_dir, (unsigned)i).c_str());
+		::remove(corpus_path(in_dir, (unsigned)i).c_str());
+	}
+	remove_dir(out_dir);
+	remove_dir(in_dir);
+}
+
+
+static void PrintUsage()
+{
+	printf("Usage: bcBench [-n Files] [-f Functions] [-s Strings] [-l StrLen] [-k Tables] [-g] [-S Seed] [-r Rounds] [-d TmpDir] [-o CorpusDir]\n");
+}
+
+int main(int _argc, char** _argv)
+{
+	for (int i = 1; i < _argc; ++i)
+	{
+		std::string arg = _argv[i];
+		bool has_val = i + 1 < _argc;
+		if (arg == "-g")
+		{
+			g_Bench.debug = true;
+		}
+		else if (arg == "-n" && has_val)
+		{
+			g_Bench.files = (unsigned)atoi(_argv[++i]);
+		}
+		else if (arg == "-f" && has_val)
+		{
+			g_Bench.protos = (unsigned)atoi(_argv[++i]);
+		}
+		else if (arg == "-s" && has_val)
+		{
+			g_Bench.strings = (unsigned)atoi(_argv[++i]);
+		}
+		else if (arg == "-l" && has_val)
+		{
+			g_Bench.str_len = std::max(1, atoi(_argv[++i]));
+		}
+		else if (arg == "-k" && has_val)
+		{
+			g_Bench.tables = (unsigned)atoi(_argv[++i]);
+		}
+		else if (arg == "-S" && has_val)
+		{
+			g_Bench.seed = (unsigned)atoi(_argv[++i]);
+		}
+		else if (arg == "-r" && has_val)
+		{
+			g_Bench.rounds = std::max(1, atoi(_argv[++i]));
+		}
+		else if (arg == "-d" && has_val)
+		{
+			g_Bench.tmp_dir = _argv[++i];
+		}
+		else if (arg == "-o" && has_val)
+		{
+			g_Bench.out_dir = _argv[++i];
+		}
+		else
+		{
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	BenchCorpus corpus;
+	if (!make_corpus(corpus))
+	{
+		return 1;
+	}
+	if (!g_Bench.out_dir.empty())
+	{
+		if (!write_corpus(corpus, g_Bench.out_dir))
+		{
+			fprintf(stderr, "bcBench: cannot write %s\n", g_Bench.out_dir.c_str());
+			return 1;
+		}
+		printf("%u files, %.2f MB written to %s\n", (unsigned)corpus.dumps.size(), corpus.bytes / 1048576.0, g_Bench.out_dir.c_str());
+		return 0;
+	}
+
+	printf("corpus: %u files, %u functions, %u strings of ~%u bytes, %u tables, %s, seed %u, %.2f MB; best of %u rounds\n",
+		g_Bench.files, g_Bench.protos, g_Bench.strings, g_Bench.str_len, g_Bench.tables,
+		g_Bench.debug ? "debug" : "stripped", g_Bench.seed, corpus.bytes / 1048576.0, g_Bench.rounds);
+	bench_strdec();
+	bench_str_new();
+	bench_decode(corpus, "decode (bcwrite)", 0);
+	bench_decode(corpus, "decode (transcode)", 1);
+	bench_end_to_end(corpus);
+	return 0;
+}
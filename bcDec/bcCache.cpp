@@ -0,0 +1,171 @@
+#include "bcCache.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <fstream>
+#include <sys/stat.h>
+#include <sys/types.h>
+#ifdef _WIN32
+#include <windows.h>
+#include <direct.h>
+#include <process.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/ioctl.h>
+#include <linux/fs.h>
+#endif
+#endif
+
+#include "bcHash.h"
+
+
+static bool make_dir(const std::string& _path)
+{
+#ifdef _WIN32
+	int ret = _mkdir(_path.c_str());
+#else
+	int ret = mkdir(_path.c_str(), 0755);
+#endif
+	return ret == 0 || errno == EEXIST;
+}
+
+static bool is_file(const std::string& _path)
+{
+	struct stat st;
+	return stat(_path.c_str(), &st) == 0 && (st.st_mode & S_IFMT) == S_IFREG;
+}
+
+static int current_pid()
+{
+#ifdef _WIN32
+	return _getpid();
+#else
+	return (int)getpid();
+#endif
+}
+
+bool BCDecCache::open(const std::string& _dir, const std::string& _version)
+{
+	std::string dir = _dir;
+	while (dir.length() > 1 && (dir.back() == '/' || dir.back() == '\\'))
+	{
+		dir.pop_back();
+	}
+	root = dir + "/" + bchash_hex(bchash64(_version.data(), _version.size()));
+	if (!make_dir(dir) || !make_dir(root))
+	{
+		return false;
+	}
+	// Names the decoder behind the entries for whoever looks at the directory.
+	std::string tag = root + "/version";
+	if (!is_file(tag))
+	{
+		std::ofstream ofs(tag.c_str(), std::ios::trunc);
+		ofs << _version << '\n';
+	}
+	return true;
+}
+
+std::string BCDecCache::entry_path(uint64_t _in_hash, size_t _in_size) const
+{
+	std::string hex = bchash_hex(_in_hash);
+	return root + "/" + hex.substr(0, 2) + "/" + hex + "-" + std::to_string(_in_size) + ".lj";
+}
+
+bool BCDecCache::lookup(uint64_t _in_hash, size_t _in_size, std::string* _entry)
+{
+	*_entry = entry_path(_in_hash, _in_size);
+	if (is_file(*_entry))
+	{
+		hits++;
+		return true;
+	}
+	misses++;
+	return false;
+}
+
+bool BCDecCache::link(const std::string& _entry, const std::string& _dst)
+{
+	remove(_dst.c_str());
+#ifdef _WIN32
+	if (CreateHardLinkA(_dst.c_str(), _entry.c_str(), nullptr))
+	{
+		linked++;
+		return true;
+	}
+	return false;
+#else
+	if (::link(_entry.c_str(), _dst.c_str()) == 0)
+	{
+		linked++;
+		return true;
+	}
+#ifdef FICLONE
+	// Hard links can be refused (link count limit, protected_hardlinks);
+	// a reflink still shares the extents on Btrfs and XFS.
+	int in = ::open(_entry.c_str(), O_RDONLY);
+	if (in < 0)
+	{
+		return false;
+	}
+	int out = ::open(_dst.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0644);
+	bool ok = out >= 0 && ioctl(out, FICLONE, in) == 0;
+	if (out >= 0 && ::close(out) != 0)
+	{
+		ok = false;
+	}
+	::close(in);
+	if (!ok)
+	{
+		::unlink(_dst.c_str());
+		return false;
+	}
+	linked++;
+	return true;
+#else
+	return false;
+#endif
+#endif
+}
+
+bool BCDecCache::store(uint64_t _in_hash, size_t _in_size, const char* _data, size_t _size, std::string* _entry)
+{
+	*_entry = entry_path(_in_hash, _in_size);
+	std::string hex = bchash_hex(_in_hash);
+	if (!make_dir(root + "/" + hex.substr(0, 2)))
+	{
+		return false;
+	}
+	std::string tmp = *_entry + ".tmp" + std::to_string(current_pid()) + "-" + std::to_string(tmp_seq++);
+	{
+		std::ofstream ofs(tmp.c_str(), std::ios::binary | std::ios::trunc);
+		ofs.write(_data, (std::streamsize)_size);
+		ofs.close();
+		if (ofs.fail())
+		{
+			remove(tmp.c_str());
+			return false;
+		}
+	}
+#ifdef _WIN32
+	bool ok = MoveFileExA(tmp.c_str(), _entry->c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+	chmod(tmp.c_str(), 0444);
+	bool ok = rename(tmp.c_str(), _entry->c_str()) == 0;
+#endif
+	if (!ok)
+	{
+		remove(tmp.c_str());
+		return false;
+	}
+	stored++;
+	return true;
+}
+
+void BCDecCache::print_summary() const
+{
+	printf("cache    : %u hits, %u misses, %u stored, %u outputs linked\n",
+		(unsigned)hits, (unsigned)misses, (unsigned)stored, (unsigned)linked);
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <string>
+
+// Content-addressed store of decoded outputs, shared by any number of bcDec
+// processes. Layout:
+//   CacheDir/<XXH64 of the decoder version>/<2 hex digits>/<XXH64 of the input>-<input size>.lj
+// Entries are written to a temporary name and renamed into place, so a
+// reader only ever sees complete files. Entries are read-only; outputs are
+// hard links or reflinks to them and bcDec replaces an output instead of
+// rewriting it.
+class BCDecCache
+{
+public:
+	BCDecCache() : hits(0), misses(0), linked(0), stored(0), tmp_seq(0) {}
+
+	bool open(const std::string& _dir, const std::string& _version);
+
+	// Returns true and the entry path if the output of this input is cached.
+	bool lookup(uint64_t _in_hash, size_t _in_size, std::string* _entry);
+	// Replaces _dst with a hard link to _entry, or a reflink where hard links
+	// are refused. Returns false if neither works; the caller copies instead.
+	bool link(const std::string& _entry, const std::string& _dst);
+	// Publishes the output of an input. Concurrent stores of the same input
+	// are harmless: each renames an identical file into place.
+	bool store(uint64_t _in_hash, size_t _in_size, const char* _data, size_t _size, std::string* _entry);
+
+	void print_summary() const;
+
+private:
+	BCDecCache(const BCDecCache&);
+	BCDecCache& operator=(const BCDecCache&);
+
+	std::string entry_path(uint64_t _in_hash, size_t _in_size) const;
+
+	std::string root;
+	std::atomic<unsigned> hits;
+	std::atomic<unsigned> misses;
+	std::atomic<unsigned> linked;
+	std::atomic<unsigned> stored;
+	std::atomic<unsigned> tmp_seq;
+};
@@ -0,0 +1,872 @@
+#include "bcCore.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lua.h"
+#include "lauxlib.h"
+#include "lj_arch.h"
+#include "lj_obj.h"
+#include "lj_gc.h"
+#include "lj_state.h"
+#include "lj_tab.h"
+#include "lj_ctype.h"
+#include "lj_bcdump.h"
+
+static_assert((int)BCDEC_KIND_INVALID == (int)BCPROBE_INVALID && (int)BCDEC_KIND_SOURCE == (int)BCPROBE_SOURCE &&
+	(int)BCDEC_KIND_STANDARD == (int)BCPROBE_STANDARD && (int)BCDEC_KIND_OBFUSCATED == (int)BCPROBE_OBFUSCATED,
+	"bcdec_probe() returns lj_bcprobe_mod() kinds");
+
+
+struct bcdec_ctx
+{
+	lua_State* L;
+	std::vector<char> scratch;
+	std::string err;
+	std::string err_section;  // Empty if the last error has no position.
+	size_t err_offset;
+	bcdec_stats stats;
+	lua_Alloc allocf;  // Wrapped allocator while stats are tracked.
+	void* allocd;
+};
+
+static double seconds_since(std::chrono::steady_clock::time_point _begin)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - _begin).count();
+}
+
+// Sits in front of the state's allocator to track the peak of g->gc.total,
+// which is only updated after the allocation returns.
+static void* alloc_peak(void* ud, void* ptr, size_t osize, size_t nsize)
+{
+	bcdec_ctx* ctx = (bcdec_ctx*)ud;
+	size_t total = (size_t)G(ctx->L)->gc.total - osize + nsize;
+	if (total > ctx->stats.peak_mem)
+	{
+		ctx->stats.peak_mem = total;
+	}
+	return ctx->allocf(ctx->allocd, ptr, osize, nsize);
+}
+
+static void count_strings(GCproto* _pt, bcdec_stats* _st)
+{
+	_st->protos++;
+	for (MSize i = 1; i <= _pt->sizekgc; ++i)
+	{
+		GCobj* o = proto_kgc(_pt, -(ptrdiff_t)i);
+		if (o->gch.gct == ~LJ_TSTR)
+		{
+			_st->strings++;
+			_st->string_bytes += gco2str(o)->len;
+		}
+		else if (o->gch.gct == ~LJ_TPROTO)
+		{
+			count_strings(gco2pt(o), _st);
+		}
+	}
+}
+
+struct ReaderCtx
+{
+	const char* data;
+	size_t size;
+};
+
+static const char* reader_mem(lua_State* L, void* ud, size_t* size)
+{
+	ReaderCtx* ctx = (ReaderCtx*)ud;
+	const char* p = ctx->data;
+	*size = ctx->size;
+	ctx->data = nullptr;
+	ctx->size = 0;
+	UNUSED(L);
+	return *size ? p : nullptr;
+}
+
+struct WriterCtx
+{
+	bcdec_sink* sink;
+	bool failed;
+};
+
+static bool sink_put(WriterCtx* _w, const void* _p, size_t _n)
+{
+	bcdec_sink* s = _w->sink;
+	if (s->write)
+	{
+		if (s->write(s->ud, _p, _n) != 0)
+		{
+			_w->failed = true;
+			return false;
+		}
+	}
+	else if (s->size <= s->cap && _n <= s->cap - s->size)
+	{
+		memcpy((char*)s->buf + s->size, _p, _n);
+	}
+	s->size += _n;
+	return true;
+}
+
+static int writer_sink(lua_State* L, const void* p, size_t size, void* ud)
+{
+	UNUSED(L);
+	return sink_put((WriterCtx*)ud, p, size) ? 0 : 1;
+}
+
+static int sink_vector(void* ud, const void* p, size_t n)
+{
+	std::vector<char>* v = (std::vector<char>*)ud;
+	v->insert(v->end(), (const char*)p, (const char*)p + n);
+	return 0;
+}
+
+static const char CHUNK_PREFIX[] = "bcdec: ";
+
+// Keeps the message without the chunk name, and the section and offset
+// the reader appends as "(kgc at offset 123)".
+static int set_error(bcdec_ctx* _ctx, int _code, const char* _msg)
+{
+	_ctx->err = _msg ? _msg : "";
+	if (_ctx->err.compare(0, sizeof(CHUNK_PREFIX) - 1, CHUNK_PREFIX) == 0)
+	{
+		_ctx->err.erase(0, sizeof(CHUNK_PREFIX) - 1);
+	}
+	_ctx->err_section.clear();
+	size_t open = _ctx->err.rfind(" (");
+	char section[16];
+	unsigned long offset;
+	if (open != std::string::npos &&
+		sscanf(_ctx->err.c_str() + open, " (%15[a-z] at offset %lu)", section, &offset) == 2)
+	{
+		_ctx->err_section = section;
+		_ctx->err_offset = offset;
+	}
+	return _code;
+}
+
+static int finish(bcdec_ctx* _ctx, bcdec_sink* _out, WriterCtx& _w)
+{
+	if (_w.failed)
+	{
+		return set_error(_ctx, BCDEC_ERR_WRITE, "sink write failed");
+	}
+	if (!_out->write && _out->size > _out->cap)
+	{
+		return set_error(_ctx, BCDEC_ERR_SPACE, "output buffer too small");
+	}
+	return BCDEC_OK;
+}
+
+// For passes that only learn that a dump is malformed. Reads it again with
+// the bounds-checked reader so the error has a section and offset.
+static int format_error(bcdec_ctx* _ctx, const char* _in, size_t _n)
+{
+	lua_State* L = _ctx->L;
+	ReaderCtx rd = { _in, _n };
+	int status = lua_loadx(L, reader_mem, &rd, "=bcdec", "b");
+	int r = status != 0 ? set_error(_ctx, status == LUA_ERRMEM ? BCDEC_ERR_MEM : BCDEC_ERR_FORMAT, lua_tostring(L, -1))
+						: set_error(_ctx, BCDEC_ERR_FORMAT, "malformed dump");
+	lua_pop(L, 1);
+	return r;
+}
+
+static int decode_transcode(bcdec_ctx* _ctx, const char* _in, size_t _n, bcdec_sink* _out)
+{
+	WriterCtx w = { _out, false };
+	char* dst;
+	// The transcoded dump is never longer than its input.
+	bool direct = !_out->write && _out->size <= _out->cap && _out->cap - _out->size >= _n;
+	if (direct)
+	{
+		dst = (char*)_out->buf + _out->size;
+	}
+	else
+	{
+		_ctx->scratch.resize(_n);
+		dst = _ctx->scratch.data();
+	}
+	auto begin = std::chrono::steady_clock::now();
+	size_t sz = lj_bctrans_mod(_in, _n, dst);
+	_ctx->stats.bcwrite_seconds = seconds_since(begin);
+	if (sz == 0)
+	{
+		return format_error(_ctx, _in, _n);
+	}
+	if (direct)
+	{
+		_out->size += sz;
+	}
+	else
+	{
+		sink_put(&w, dst, sz);
+	}
+	return finish(_ctx, _out, w);
+}
+
+// Below this size an obfuscated dump is decoded on the calling thread only.
+static const size_t PARALLEL_MIN_BYTES = 1 << 20;
+
+// First phase of a parallel decode: transcodes the prototype records of an
+// obfuscated dump on _threads threads into a standard dump in scratch.
+// Returns false if the dump does not split into well-formed records, so the
+// serial reader can report where it breaks.
+static bool transcode_parallel(bcdec_ctx* _ctx, const char* _in, size_t _n, unsigned _threads)
+{
+	MSize count = lj_bcindex_mod(_in, _n, nullptr, 0);
+	if (count == 0)
+	{
+		return false;
+	}
+	std::vector<BCProtoRec> rec(count);
+	lj_bcindex_mod(_in, _n, rec.data(), count);
+	// Records never grow, so each one is written at its input position.
+	std::vector<char>& out = _ctx->scratch;
+	out.resize(_n);
+	std::vector<size_t> len(count);
+	std::atomic<bool> ok(true);
+	auto work = [&](MSize _first, MSize _last)
+	{
+		for (MSize i = _first; i < _last && ok; ++i)
+		{
+			len[i] = lj_bctrans_proto_mod(_in, _n, &rec[i], out.data() + rec[i].pos);
+			if (len[i] == 0)
+			{
+				ok = false;
+			}
+		}
+	};
+	// Each thread takes a run of records covering about the same bytes.
+	std::vector<std::thread> workers;
+	MSize first = 0;
+	for (unsigned t = 1; t < _threads && first < count; ++t)
+	{
+		size_t end = _n / _threads * t;
+		MSize last = first;
+		while (last < count && rec[last].pos < end)
+		{
+			++last;
+		}
+		if (last > first)
+		{
+			workers.emplace_back(work, first, last);
+		}
+		first = last;
+	}
+	work(first, count);
+	for (std::thread& w : workers)
+	{
+		w.join();
+	}
+	if (!ok)
+	{
+		return false;
+	}
+	// Close the gaps left by records that shrank.
+	size_t q = lj_bctrans_head_mod(_in, _n, &rec[count - 1], out.data());
+	for (MSize i = 0; i < count; ++i)
+	{
+		memmove(out.data() + q, out.data() + rec[i].pos, len[i]);
+		q += len[i];
+	}
+	out[q++] = 0;
+	out.resize(q);
+	return true;
+}
+
+static int decode_copy(bcdec_ctx* _ctx, const char* _in, size_t _n, bcdec_sink* _out)
+{
+	WriterCtx w = { _out, false };
+	sink_put(&w, _in, _n);
+	return finish(_ctx, _out, w);
+}
+
+// -- Bytecode validation ---------------------------------------------------
+
+#define BCVMODE(name, ma, mb, mc, mt) { BCM##ma, BCM##mb, BCM##mc },
+static const uint8_t bc_modes[][3] = { BCDEF(BCVMODE) };
+#undef BCVMODE
+#define BCVNAME(name, ma, mb, mc, mt) #name,
+static const char* const bc_names[] = { BCDEF(BCVNAME) };
+#undef BCVNAME
+
+static bool kgc_is(GCproto* _pt, uint32_t _idx, uint32_t _gct)
+{
+	return _idx < _pt->sizekgc && proto_kgc(_pt, ~(ptrdiff_t)_idx)->gch.gct == _gct;
+}
+
+// Checks an operand of instruction _pc against its BCMode. Returns what is
+// wrong with it, or nullptr.
+static const char* verify_operand(GCproto* _pt, int _mode, uint32_t _v, MSize _pc)
+{
+	int32_t target;
+	switch (_mode)
+	{
+	case BCMdst: case BCMbase: case BCMvar:
+		return _v < _pt->framesize ? nullptr : "is not a slot of the frame";
+	case BCMrbase:
+		return _v <= _pt->framesize ? nullptr : "is past the frame";
+	case BCMuv:
+		return _v < _pt->sizeuv ? nullptr : "is not an upvalue";
+	case BCMpri:
+		return _v <= 2 ? nullptr : "is not nil, false or true";
+	case BCMnum:
+		return _v < _pt->sizekn ? nullptr : "is not a number constant";
+	case BCMstr:
+		return kgc_is(_pt, _v, ~LJ_TSTR) ? nullptr : "is not a string constant";
+	case BCMtab:
+		return kgc_is(_pt, _v, ~LJ_TTAB) ? nullptr : "is not a table constant";
+	case BCMfunc:
+		return kgc_is(_pt, _v, ~LJ_TPROTO) ? nullptr : "is not a child function";
+	case BCMcdata:
+		return kgc_is(_pt, _v, ~LJ_TCDATA) ? nullptr : "is not a cdata constant";
+	case BCMjump:
+		target = (int32_t)(_pc + 1 + _v) - BCBIAS_J;
+		return target >= 1 && target < (int32_t)_pt->sizebc ? nullptr : "jumps out of the function";
+	default:
+		return nullptr;
+	}
+}
+
+// Checks one function against its frame, constants and upvalues, and the
+// upvalue descriptors against the parent. Children are checked first and
+// numbered in dump order, like --list.
+static bool verify_proto(GCproto* _pt, GCproto* _parent, unsigned* _index, std::string* _err)
+{
+	for (MSize i = 1; i <= _pt->sizekgc; ++i)
+	{
+		GCobj* o = proto_kgc(_pt, -(ptrdiff_t)i);
+		if (o->gch.gct == ~LJ_TPROTO && !verify_proto(gco2pt(o), _pt, _index, _err))
+		{
+			return false;
+		}
+	}
+	unsigned fn = (*_index)++;
+	char msg[160];
+	auto fail = [&](const char* _what)
+	{
+		snprintf(msg, sizeof(msg), "invalid bytecode: function %u: %s", fn, _what);
+		*_err = msg;
+		return false;
+	};
+	if (_pt->numparams > _pt->framesize)
+	{
+		return fail("more parameters than frame slots");
+	}
+	const uint16_t* uv = proto_uv(_pt);
+	for (MSize i = 0; _parent && i < _pt->sizeuv; ++i)
+	{
+		bool ok = (uv[i] & PROTO_UV_LOCAL) ? (uv[i] & 0xff) < _parent->framesize :
+			(uv[i] & ~PROTO_UV_IMMUTABLE) < _parent->sizeuv;
+		if (!ok)
+		{
+			return fail("upvalue refers past the parent's frame or upvalues");
+		}
+	}
+	const BCIns* bc = proto_bc(_pt);
+	for (MSize pc = 1; pc < _pt->sizebc; ++pc)
+	{
+		BCIns ins = bc[pc];
+		BCOp op = bc_op(ins);
+		const char* what = nullptr;
+		char operand = 0;
+		if (op >= BC_FUNCF)
+		{
+			what = "is not an instruction of a function body";
+		}
+		else if ((what = verify_operand(_pt, bc_modes[op][0], bc_a(ins), pc)))
+		{
+			operand = 'A';
+		}
+		else if (bc_modes[op][1] != BCMnone)
+		{
+			if ((what = verify_operand(_pt, bc_modes[op][1], bc_b(ins), pc)))
+			{
+				operand = 'B';
+			}
+			else if ((what = verify_operand(_pt, bc_modes[op][2], bc_c(ins), pc)))
+			{
+				operand = 'C';
+			}
+		}
+		else if ((what = verify_operand(_pt, bc_modes[op][2], bc_d(ins), pc)))
+		{
+			operand = 'D';
+		}
+		if (what)
+		{
+			char where[96];
+			if (operand)
+			{
+				snprintf(where, sizeof(where), "instruction %u: %s %c %s", (unsigned)pc, bc_names[op], operand, what);
+			}
+			else
+			{
+				snprintf(where, sizeof(where), "instruction %u: opcode %u %s", (unsigned)pc, (unsigned)op, what);
+			}
+			return fail(where);
+		}
+	}
+	BCOp last = bc_op(bc[_pt->sizebc - 1]);
+	if (_pt->sizebc < 2 || !(bc_isret(last) || last == BC_CALLT || last == BC_CALLMT))
+	{
+		return fail("does not end with a return or a tail call");
+	}
+	return true;
+}
+
+static int decode_load(bcdec_ctx* _ctx, const char* _in, size_t _n, bcdec_sink* _out, const char* _mode, bool _stats,
+	bool _verify)
+{
+	lua_State* L = _ctx->L;
+	WriterCtx w = { _out, false };
+	ReaderCtx rd = { _in, _n };
+	auto begin = std::chrono::steady_clock::now();
+	int status = lua_loadx(L, reader_mem, &rd, "=bcdec", _mode);
+	_ctx->stats.bcread_seconds = seconds_since(begin);
+	if (status != 0)
+	{
+		return set_error(_ctx, status == LUA_ERRMEM ? BCDEC_ERR_MEM : BCDEC_ERR_FORMAT, lua_tostring(L, -1));
+	}
+	GCproto* pt = funcproto(funcV(L->top - 1));
+	if (_stats)
+	{
+		count_strings(pt, &_ctx->stats);
+	}
+	unsigned index = 0;
+	std::string err;
+	if (_verify && !verify_proto(pt, nullptr, &index, &err))
+	{
+		return set_error(_ctx, BCDEC_ERR_VERIFY, err.c_str());
+	}
+	begin = std::chrono::steady_clock::now();
+	status = lj_bcwrite(L, pt, writer_sink, &w, 1);
+	_ctx->stats.bcwrite_seconds = seconds_since(begin);
+	if (status != 0 && !w.failed)
+	{
+		return set_error(_ctx, status == LUA_ERRMEM ? BCDEC_ERR_MEM : BCDEC_ERR_FORMAT, lua_tostring(L, -1));
+	}
+	return finish(_ctx, _out, w);
+}
+
+static void visit_tvstr(cTValue* _o, bcdec_str_fn _fn, void* _ud)
+{
+	if (tvisstr(_o))
+	{
+		GCstr* str = strV(_o);
+		_fn(_ud, strdata(str), str->len, BCDEC_STR_KTAB);
+	}
+}
+
+static void visit_strings(GCproto* _pt, bcdec_str_fn _fn, void* _ud)
+{
+	// Constants are stored back to front, so walk them from -sizekgc.
+	for (MSize i = _pt->sizekgc; i >= 1; --i)
+	{
+		GCobj* o = proto_kgc(_pt, -(ptrdiff_t)i);
+		if (o->gch.gct == ~LJ_TSTR)
+		{
+			_fn(_ud, strdata(gco2str(o)), gco2str(o)->len, BCDEC_STR_KGC);
+		}
+		else if (o->gch.gct == ~LJ_TTAB)
+		{
+			GCtab* t = gco2tab(o);
+			for (uint32_t j = 0; j < t->asize; ++j)
+			{
+				visit_tvstr(arrayslot(t, j), _fn, _ud);
+			}
+			Node* node = noderef(t->node);
+			for (uint32_t j = 0; t->hmask && j <= t->hmask; ++j)
+			{
+				if (!tvisnil(&node[j].val))
+				{
+					visit_tvstr(&node[j].key, _fn, _ud);
+					visit_tvstr(&node[j].val, _fn, _ud);
+				}
+			}
+		}
+		else if (o->gch.gct == ~LJ_TPROTO)
+		{
+			visit_strings(gco2pt(o), _fn, _ud);
+		}
+	}
+}
+
+bcdec_ctx* bcdec_new(void)
+{
+	// Workers may create their contexts concurrently. The static's
+	// initializer runs once and the others wait for it, so the string
+	// kernel is settled before any context can read a dump.
+	static const bool s_kernel = (lj_bcstrdec_init(), true);
+	(void)s_kernel;
+	lua_State* L = luaL_newstate();
+	if (!L)
+	{
+		return nullptr;
+	}
+	// The reader opens ffi on demand and anchors it in _LOADED, which a bare state lacks.
+	luaL_findtable(L, LUA_REGISTRYINDEX, "_LOADED", 16);
+	lua_pop(L, 1);
+	bcdec_ctx* ctx = new bcdec_ctx;
+	ctx->L = L;
+	ctx->err_offset = 0;
+	ctx->stats = bcdec_stats();
+	ctx->allocf = nullptr;
+	ctx->allocd = nullptr;
+	return ctx;
+}
+
+void bcdec_free(bcdec_ctx* _ctx)
+{
+	if (_ctx)
+	{
+		lua_close(_ctx->L);
+		delete _ctx;
+	}
+}
+
+int bcdec_decode(bcdec_ctx* _ctx, const void* _in, size_t _n, bcdec_sink* _out, const bcdec_opts* _opts)
+{
+	static const bcdec_opts defaults = { 0, 0, 0, 0, 0, 0, 0 };
+	const bcdec_opts* opts = _opts ? _opts : &defaults;
+	const char* in = (const char*)_in;
+	bool stats = opts->stats != 0;
+	bool verify = opts->verify != 0;
+	int r;
+	_out->size = 0;
+	_ctx->err.clear();
+	_ctx->err_section.clear();
+	_ctx->stats = bcdec_stats();
+	if (stats && !_ctx->allocf)
+	{
+		_ctx->allocf = lua_getallocf(_ctx->L, &_ctx->allocd);
+		lua_setallocf(_ctx->L, alloc_peak, _ctx);
+	}
+	if (stats)
+	{
+		_ctx->stats.peak_mem = (size_t)G(_ctx->L)->gc.total;
+	}
+	switch (bcdec_probe(in, _n))
+	{
+	case BCDEC_KIND_STANDARD:
+		return decode_copy(_ctx, in, _n, _out);
+	case BCDEC_KIND_OBFUSCATED:
+		if (opts->threads > 1 && _n >= PARALLEL_MIN_BYTES)
+		{
+			auto begin = std::chrono::steady_clock::now();
+			if (transcode_parallel(_ctx, in, _n, opts->threads))
+			{
+				double split = seconds_since(begin);
+				if (opts->transcode)
+				{
+					_ctx->stats.bcwrite_seconds = split;
+					return decode_copy(_ctx, _ctx->scratch.data(), _ctx->scratch.size(), _out);
+				}
+				r = decode_load(_ctx, _ctx->scratch.data(), _ctx->scratch.size(), _out, "b", stats, verify);
+				_ctx->stats.bcread_seconds += split;
+				// A load error's offset points into scratch. Redo it on the
+				// input so it names the caller's bytes, unless output started.
+				if (r != BCDEC_ERR_FORMAT || _out->size != 0)
+				{
+					break;
+				}
+				lua_settop(_ctx->L, 0);
+			}
+		}
+		if (opts->transcode)
+		{
+			return decode_transcode(_ctx, in, _n, _out);
+		}
+		r = decode_load(_ctx, in, _n, _out, "b", stats, verify);
+		break;
+	case BCDEC_KIND_SOURCE:
+		r = decode_load(_ctx, in, _n, _out, "t", stats, verify);
+		break;
+	default:
+		if (_n == 0)
+		{
+			return set_error(_ctx, BCDEC_ERR_FORMAT, "empty input");
+		}
+		if (_n < 4 || (uint8_t)in[0] != BCDUMP_HEAD1 || (uint8_t)in[1] != BCDUMP_HEAD2 ||
+			(uint8_t)in[2] != BCDUMP_HEAD3 || (uint8_t)in[3] != BCDUMP_VERSION)
+		{
+			return set_error(_ctx, BCDEC_ERR_FORMAT, "malformed dump");
+		}
+		// The header is fine but the first prototype did not probe, e.g. a
+		// truncated file. The bounds-checked reader fails on it with the
+		// section and offset.
+		r = decode_load(_ctx, in, _n, _out, "b", stats, verify);
+		break;
+	}
+	lua_settop(_ctx->L, 0);
+	if (opts->reset)
+	{
+		lj_gc_reset_mod(_ctx->L, opts->str_hint, opts->buf_hint);
+	}
+	return r;
+}
+
+// nil, false and true keep whatever payload the slot had before.
+static bool tv_same(cTValue* _a, cTValue* _b)
+{
+	return tvispri(_a) ? itype(_a) == itype(_b) : _a->u64 == _b->u64;
+}
+
+static bool tab_same(lua_State* L, GCtab* _a, GCtab* _b)
+{
+	if (_a->asize != _b->asize || _a->hmask != _b->hmask)
+	{
+		return false;
+	}
+	for (uint32_t i = 0; i < _a->asize; ++i)
+	{
+		if (!tv_same(arrayslot(_a, i), arrayslot(_b, i)))
+		{
+			return false;
+		}
+	}
+	// The hash part is written in node order, which differs between loads.
+	Node* node = noderef(_a->node);
+	for (uint32_t i = 0; _a->hmask && i <= _a->hmask; ++i)
+	{
+		if (!tvisnil(&node[i].val) && !tv_same(lj_tab_get(L, _b, &node[i].key), &node[i].val))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Compares two loads of the same function. Both live in one state, so equal
+// strings are the same object.
+static bool proto_same(lua_State* L, GCproto* _a, GCproto* _b)
+{
+	if (_a->sizebc != _b->sizebc || _a->sizekgc != _b->sizekgc || _a->sizekn != _b->sizekn ||
+		_a->sizeuv != _b->sizeuv || _a->framesize != _b->framesize || _a->numparams != _b->numparams ||
+		_a->flags != _b->flags ||
+		memcmp(proto_bc(_a), proto_bc(_b), _a->sizebc * sizeof(BCIns)) != 0 ||
+		memcmp(proto_uv(_a), proto_uv(_b), _a->sizeuv * sizeof(uint16_t)) != 0 ||
+		memcmp(mref(_a->k, TValue), mref(_b->k, TValue), _a->sizekn * sizeof(TValue)) != 0)
+	{
+		return false;
+	}
+	for (MSize i = 1; i <= _a->sizekgc; ++i)
+	{
+		GCobj* a = proto_kgc(_a, -(ptrdiff_t)i);
+		GCobj* b = proto_kgc(_b, -(ptrdiff_t)i);
+		if (a->gch.gct != b->gch.gct)
+		{
+			return false;
+		}
+		if (a->gch.gct == ~LJ_TPROTO)
+		{
+			if (!proto_same(L, gco2pt(a), gco2pt(b)))
+			{
+				return false;
+			}
+		}
+		else if (a->gch.gct == ~LJ_TTAB)
+		{
+			if (!tab_same(L, gco2tab(a), gco2tab(b)))
+			{
+				return false;
+			}
+		}
+		else if (a->gch.gct == ~LJ_TCDATA)
+		{
+			GCcdata* ca = gco2cd(a);
+			GCcdata* cb = gco2cd(b);
+			size_t sz = ca->ctypeid == CTID_COMPLEX_DOUBLE ? 16 : 8;
+			if (ca->ctypeid != cb->ctypeid || memcmp(cdataptr(ca), cdataptr(cb), sz) != 0)
+			{
+				return false;
+			}
+		}
+		else if (a != b)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+int bcdec_check_roundtrip(bcdec_ctx* _ctx, const void* _in, size_t _n)
+{
+	lua_State* L = _ctx->L;
+	std::vector<char> first;
+	bcdec_sink s1 = {};
+	s1.write = sink_vector;
+	s1.ud = &first;
+	_ctx->err.clear();
+	_ctx->err_section.clear();
+	if (bcdec_probe(_in, _n) != BCDEC_KIND_OBFUSCATED)
+	{
+		return set_error(_ctx, BCDEC_ERR_FORMAT, "not an obfuscated dump");
+	}
+	// Keeps the decoded function on the stack to compare with the reload.
+	int r = decode_load(_ctx, (const char*)_in, _n, &s1, "b", false, false);
+	if (r == BCDEC_OK)
+	{
+		ReaderCtx rd = { first.data(), first.size() };
+		int status = lua_loadx(L, reader_mem, &rd, "=bcdec", "b");
+		if (status != 0)
+		{
+			r = set_error(_ctx, status == LUA_ERRMEM ? BCDEC_ERR_MEM : BCDEC_ERR_FORMAT, lua_tostring(L, -1));
+		}
+		else if (!proto_same(L, funcproto(funcV(L->top - 2)), funcproto(funcV(L->top - 1))))
+		{
+			r = set_error(_ctx, BCDEC_ERR_FORMAT, "output does not read back unchanged");
+		}
+	}
+	lua_settop(L, 0);
+	return r;
+}
+
+int bcdec_probe(const void* _in, size_t _n)
+{
+	return lj_bcprobe_mod((const char*)_in, _n);
+}
+
+int bcdec_strings(bcdec_ctx* _ctx, const void* _in, size_t _n, bcdec_str_fn _fn, void* _ud)
+{
+	lua_State* L = _ctx->L;
+	ReaderCtx rd = { (const char*)_in, _n };
+	_ctx->err.clear();
+	_ctx->err_section.clear();
+	int status = lua_loadx(L, reader_mem, &rd, "=bcdec", nullptr);
+	if (status != 0)
+	{
+		int r = set_error(_ctx, status == LUA_ERRMEM ? BCDEC_ERR_MEM : BCDEC_ERR_FORMAT, lua_tostring(L, -1));
+		lua_settop(L, 0);
+		return r;
+	}
+	visit_strings(funcproto(funcV(L->top - 1)), _fn, _ud);
+	lua_settop(L, 0);
+	return BCDEC_OK;
+}
+
+size_t bcdec_index(const void* _in, size_t _n, bcdec_proto* _out, size_t _max)
+{
+	std::vector<BCProtoRec> recs(_max);
+	size_t count = lj_bcindex_mod((const char*)_in, _n, recs.data(), (MSize)_max);
+	for (size_t i = 0; i < count && i < _max; ++i)
+	{
+		const BCProtoRec& r = recs[i];
+		bcdec_proto& p = _out[i];
+		p.offset = r.pos;
+		p.size = r.ofs - r.pos + r.len;
+		p.first = r.first;
+		p.children = r.nchild;
+		p.flags = r.flags;
+		p.numparams = r.numparams;
+		p.framesize = r.framesize;
+		p.sizeuv = r.sizeuv;
+		p.sizebc = r.sizebc;
+		p.sizekgc = r.sizekgc;
+		p.sizekn = r.sizekn;
+	}
+	return count;
+}
+
+// Loads the subtree of prototype idx as a dump of its own: the original
+// header, the records first..idx copied verbatim and an end marker. Only
+// those records are decrypted and materialized.
+static int load_subtree(bcdec_ctx* _ctx, const char* _in, size_t _n, size_t _idx)
+{
+	// Every record takes at least two bytes, which bounds idx before allocating.
+	if (_idx >= _n)
+	{
+		return set_error(_ctx, BCDEC_ERR_FORMAT, "no such prototype");
+	}
+	std::vector<BCProtoRec> recs(_idx + 1);
+	size_t count = lj_bcindex_mod(_in, _n, recs.data(), (MSize)recs.size());
+	if (count == 0)
+	{
+		return format_error(_ctx, _in, _n);
+	}
+	if (_idx >= count)
+	{
+		return set_error(_ctx, BCDEC_ERR_FORMAT, "no such prototype");
+	}
+	const BCProtoRec& last = recs[_idx];
+	size_t head = recs[0].pos;
+	size_t begin = recs[last.first].pos;
+	size_t end = (size_t)last.ofs + last.len;
+	std::vector<char>& buf = _ctx->scratch;
+	buf.resize(head + (end - begin) + 1);
+	memcpy(buf.data(), _in, head);
+	memcpy(buf.data() + head, _in + begin, end - begin);
+	buf.back() = 0;
+	ReaderCtx rd = { buf.data(), buf.size() };
+	int status = lua_loadx(_ctx->L, reader_mem, &rd, "=bcdec", "b");
+	if (status != 0)
+	{
+		int r = set_error(_ctx, status == LUA_ERRMEM ? BCDEC_ERR_MEM : BCDEC_ERR_FORMAT, lua_tostring(_ctx->L, -1));
+		lua_pop(_ctx->L, 1);
+		return r;
+	}
+	return BCDEC_OK;
+}
+
+int bcdec_load_proto(bcdec_ctx* _ctx, const void* _in, size_t _n, size_t _idx)
+{
+	_ctx->err.clear();
+	_ctx->err_section.clear();
+	return load_subtree(_ctx, (const char*)_in, _n, _idx);
+}
+
+int bcdec_decode_proto(bcdec_ctx* _ctx, const void* _in, size_t _n, size_t _idx, bcdec_sink* _out)
+{
+	lua_State* L = _ctx->L;
+	WriterCtx w = { _out, false };
+	_out->size = 0;
+	_ctx->err.clear();
+	_ctx->err_section.clear();
+	int r = load_subtree(_ctx, (const char*)_in, _n, _idx);
+	if (r != BCDEC_OK)
+	{
+		return r;
+	}
+	int status = lj_bcwrite(L, funcproto(funcV(L->top - 1)), writer_sink, &w, 1);
+	if (status != 0 && !w.failed)
+	{
+		r = set_error(_ctx, status == LUA_ERRMEM ? BCDEC_ERR_MEM : BCDEC_ERR_FORMAT, lua_tostring(L, -1));
+	}
+	else
+	{
+		r = finish(_ctx, _out, w);
+	}
+	lua_settop(L, 0);
+	return r;
+}
+
+lua_State* bcdec_state(bcdec_ctx* _ctx)
+{
+	return _ctx->L;
+}
+
+const bcdec_stats* bcdec_last_stats(const bcdec_ctx* _ctx)
+{
+	return &_ctx->stats;
+}
+
+const char* bcdec_errmsg(const bcdec_ctx* _ctx)
+{
+	return _ctx->err.c_str();
+}
+
+int bcdec_errpos(const bcdec_ctx* _ctx, const char** _section, size_t* _offset)
+{
+	if (_ctx->err_section.empty())
+	{
+		return 0;
+	}
+	*_section = _ctx->err_section.c_str();
+	*_offset = _ctx->err_offset;
+	return 1;
+}
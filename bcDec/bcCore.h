@@ -0,0 +1,196 @@
+#pragma once
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// In-process decoder behind the bcDec command line tool, built as the
+// bcdec_core library. A context owns one lua_State and is reused across
+// calls. Contexts are independent, use one per thread.
+
+typedef struct bcdec_ctx bcdec_ctx;
+
+// Decoded output goes to write() when it is set, otherwise into buf.
+// size is the number of bytes produced. When buf is too small, decoding
+// still runs to the end, size is the length needed and bcdec_decode()
+// returns BCDEC_ERR_SPACE.
+typedef struct bcdec_sink
+{
+	int (*write)(void* ud, const void* p, size_t n);  // Nonzero aborts with BCDEC_ERR_WRITE.
+	void* ud;
+	void* buf;
+	size_t cap;
+	size_t size;
+} bcdec_sink;
+
+typedef struct bcdec_opts
+{
+	int transcode;      // Rewrite the dump directly, without building prototypes.
+	int reset;          // Run a full GC cycle after each call.
+	unsigned str_hint;  // Minimum string table slots kept across resets.
+	unsigned buf_hint;  // Minimum temp buffer size kept across resets.
+	int stats;          // Collect bcdec_stats for each call.
+	unsigned threads;   // Threads for the byte-level pass of a large obfuscated dump; 0 or 1 is serial.
+	int verify;         // Check the operands of every instruction before writing. Needs transcode off.
+} bcdec_opts;
+
+// Measurements of the last bcdec_decode() call made with opts->stats set.
+typedef struct bcdec_stats
+{
+	double bcread_seconds;   // Loading the dump, i.e. lj_bcread_proto_mod() for every prototype.
+	double bcwrite_seconds;  // lj_bcwrite(), or lj_bctrans_mod() when transcoding.
+	unsigned protos;         // Prototypes loaded. Not counted when transcoding.
+	unsigned strings;        // String constants over all loaded prototypes.
+	size_t string_bytes;
+	size_t peak_mem;         // Highest g->gc.total seen during the call.
+} bcdec_stats;
+
+enum
+{
+	BCDEC_OK = 0,
+	BCDEC_ERR_FORMAT,  // Malformed dump or source that does not compile.
+	BCDEC_ERR_SPACE,   // Output buffer too small.
+	BCDEC_ERR_WRITE,   // The sink write function failed.
+	BCDEC_ERR_MEM,
+	BCDEC_ERR_VERIFY,  // The decoded bytecode failed opts->verify.
+};
+
+// Input kinds reported by bcdec_probe().
+enum
+{
+	BCDEC_KIND_INVALID = 0,
+	BCDEC_KIND_SOURCE,      // Lua source, compiled by the parser.
+	BCDEC_KIND_STANDARD,    // Standard dump, passed through unchanged.
+	BCDEC_KIND_OBFUSCATED,
+};
+
+bcdec_ctx* bcdec_new(void);
+void bcdec_free(bcdec_ctx* _ctx);
+
+// Classifies an input from its header and first prototype. An empty input
+// is BCDEC_KIND_INVALID.
+int bcdec_probe(const void* _in, size_t _n);
+
+// Decodes one obfuscated dump into a stripped standard dump. Standard dumps
+// are copied through and Lua source is compiled. opts may be NULL. With
+// opts->threads above 1, an obfuscated dump of 1 MB or more is transcoded
+// prototype by prototype on that many threads first, and only loading the
+// result and linking the children stays serial.
+int bcdec_decode(bcdec_ctx* _ctx, const void* _in, size_t _n, bcdec_sink* _out, const bcdec_opts* _opts);
+
+// Receives each string constant of a dump. kind is BCDEC_STR_KGC or
+// BCDEC_STR_KTAB. Equal strings of one dump share the same s pointer,
+// since they are interned.
+typedef void (*bcdec_str_fn)(void* ud, const char* s, size_t len, int kind);
+
+enum
+{
+	BCDEC_STR_KGC = 0,  // A string constant of a prototype.
+	BCDEC_STR_KTAB,     // A key or value in a template table.
+};
+
+// Loads a dump or source and calls fn for every string constant of every
+// prototype, in dump order.
+int bcdec_strings(bcdec_ctx* _ctx, const void* _in, size_t _n, bcdec_str_fn _fn, void* _ud);
+
+// One prototype of a dump, as listed by bcdec_index(). Prototypes are in
+// dump order: children come before their parent and the main chunk is last.
+typedef struct bcdec_proto
+{
+	size_t offset;      // Start of the prototype record in the input.
+	size_t size;        // Length of the record, including its length prefix.
+	size_t first;       // First prototype of its subtree, which is first..itself.
+	unsigned children;  // Number of child prototypes.
+	unsigned flags;     // PROTO_* flags.
+	unsigned numparams;
+	unsigned framesize;
+	unsigned sizeuv;
+	unsigned sizebc;    // Instructions, including the function header.
+	unsigned sizekgc;
+	unsigned sizekn;
+} bcdec_proto;
+
+// Lists the prototypes of a standard or obfuscated dump without decoding
+// them. Fills at most max entries of out and returns the number of
+// prototypes, or 0 if the input is not a well-formed dump. Call again with
+// a larger out if the result exceeds max.
+size_t bcdec_index(const void* _in, size_t _n, bcdec_proto* _out, size_t _max);
+
+// Materializes only prototype idx and its children, and leaves it as a
+// function on top of bcdec_state(ctx) for inspection, e.g. with
+// jit.util.funcinfo() or funcbc(). Pop it when done.
+int bcdec_load_proto(bcdec_ctx* _ctx, const void* _in, size_t _n, size_t _idx);
+
+// Writes prototype idx and its children as a stripped standard dump.
+int bcdec_decode_proto(bcdec_ctx* _ctx, const void* _in, size_t _n, size_t _idx, bcdec_sink* _out);
+
+// The context's lua_State. Libraries are not opened on it.
+struct lua_State* bcdec_state(bcdec_ctx* _ctx);
+
+// Installs an obfuscation profile: the opcode permutation, header layout,
+// field and section order, operand and string keys and GC constant codes
+// of one client format, as text (see bcProfile.cpp). Settings left out
+// keep their built-in value. It applies to every context of the process,
+// so load it before decoding starts. NULL restores the built-in profile.
+// On failure the active profile is unchanged and err describes the problem.
+int bcdec_load_profile(const char* _text, size_t _n, char* _err, size_t _errlen);
+
+// Writes the active profile as text, NUL terminated and cut to cap bytes.
+// Returns the full length.
+size_t bcdec_profile_text(char* _buf, size_t _cap);
+
+// Opcode map recovery for a client that renumbered its opcodes. Statistics
+// are gathered per thread over a corpus of its dumps and merged; the other
+// settings of the active profile must already match the client.
+typedef struct bcdec_opstats bcdec_opstats;
+
+typedef struct bcdec_opreport
+{
+	unsigned files;    // Dumps scanned.
+	unsigned protos;
+	size_t ins;        // Instructions, without function headers.
+	unsigned seen;     // Dump opcodes that occur in the corpus.
+	unsigned pinned;   // Of those, opcodes the constraints leave one meaning for.
+	unsigned changed;  // Entries that differ from the profile active before.
+} bcdec_opreport;
+
+bcdec_opstats* bcdec_opstats_new(void);
+void bcdec_opstats_free(bcdec_opstats* _st);
+
+// Scans one dump without decoding it. Returns BCDEC_ERR_FORMAT, and counts
+// nothing, if it does not parse in the layout of the active profile.
+int bcdec_opstats_add(bcdec_opstats* _st, const void* _in, size_t _n);
+void bcdec_opstats_merge(bcdec_opstats* _dst, const bcdec_opstats* _src);
+
+// Solves for the most likely opcode map and installs it in the active
+// profile. Each standard opcode is ruled out for a dump opcode whose
+// operands do not fit its BCMode or whose neighbours contradict how the
+// parser emits it. Opcodes of the same shape (ADDVN and SUBVN, say) are
+// told apart by how often they occur. detail gets one line for each dump
+// opcode that kept more than one candidate, cut to cap bytes. Returns
+// BCDEC_ERR_FORMAT and leaves the profile unchanged if no permutation fits.
+int bcdec_recover_opmap(const bcdec_opstats* _st, bcdec_opreport* _rep, char* _detail, size_t _cap);
+
+// Decodes an obfuscated dump, reads the output back through the standard
+// lj_bcread() and compares the two loads: bytecode, constants, template
+// tables by content and children. Returns BCDEC_OK if they match. Catches
+// maps the reader rejects or that lose data, not two same-shape opcodes
+// swapped.
+int bcdec_check_roundtrip(bcdec_ctx* _ctx, const void* _in, size_t _n);
+
+// Stats of the last call, all zero unless it was made with opts->stats.
+const bcdec_stats* bcdec_last_stats(const bcdec_ctx* _ctx);
+
+// Message for the last failed call, "" after a successful one.
+const char* bcdec_errmsg(const bcdec_ctx* _ctx);
+
+// For a malformed dump, the section where reading failed ("header", "bc",
+// "uv", "kgc", "knum" or "dbg") and the input offset. Returns 0 when the
+// last failure has no position, e.g. a bad header or a write error.
+int bcdec_errpos(const bcdec_ctx* _ctx, const char** _section, size_t* _offset);
+
+#ifdef __cplusplus
+}
+#endif
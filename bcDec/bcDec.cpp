@@ -2,39 +2,86 @@
 #include <stdio.h>
 #include <fstream>
 #include <iostream>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#ifdef _WIN32
 #include <windows.h>
 #include <io.h>
-#include <sys/stat.h>
+#include <direct.h>
+#include <fcntl.h>
+#else
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
+#endif
 #include <string>
+#include <vector>
 #include <algorithm>
+#include <deque>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "lua.h"
 #include "lauxlib.h"
 #include "lualib.h"
 #include "luajit.h"
 #include "lj_arch.h"
-#include "lj_buf.h"
-#include "lj_lib.h"
 #include "lj_bcdump.h"
 
+#include "bcCache.h"
+#include "bcCore.h"
+#include "bcHash.h"
+#include "bcPack.h"
+#include "bcRing.h"
+#include "bcStrPool.h"
+
+#ifndef BCDEC_VERSION
+#define BCDEC_VERSION "0.1.0"
+#endif
+
+
+#ifdef _WIN32
+static const char PATH_SEP = '\\';
+#else
+static const char PATH_SEP = '/';
+#endif
 
 static std::string remove_unnecessary_slashes(const std::string& path_str)
 {
 	size_t end_pos = path_str.find_last_not_of(R"(\/)");
-	size_t begin_pos = path_str.find_first_not_of(R"(\/)");
-	if ((begin_pos > path_str.length()) || (end_pos > path_str.length()))
+	if (end_pos > path_str.length())
 	{
-		return std::string();
+		return path_str.empty() ? std::string() : std::string(1, PATH_SEP);
 	}
 	else
 	{
-		return path_str.substr(begin_pos, end_pos - begin_pos + 1);
+		return path_str.substr(0, end_pos + 1);
 	}
 }
 
 static std::string append_path(const std::string& path_left, const std::string& path_right)
 {
-	return remove_unnecessary_slashes(path_left) + '\\' + remove_unnecessary_slashes(path_right);
+	std::string left = remove_unnecessary_slashes(path_left);
+	size_t begin_pos = path_right.find_first_not_of(R"(\/)");
+	std::string right = begin_pos > path_right.length() ? std::string() : remove_unnecessary_slashes(path_right.substr(begin_pos));
+	if (left.empty() || left.back() == PATH_SEP)
+	{
+		return left + right;
+	}
+	return left + PATH_SEP + right;
 }
 
 static std::string get_filename_from_path(const std::string& _filepath)
@@ -71,7 +118,11 @@ static std::string get_parent_path(std::string file_path)
 	size_t slash_pos = _norm.find_last_of(R"(\/)");
 	if (slash_pos > _norm.length())
 	{
-		return _norm;
+		return ".";
+	}
+	else if (slash_pos == 0)
+	{
+		return _norm.substr(0, 1);
 	}
 	else
 	{
@@ -79,12 +130,28 @@ static std::string get_parent_path(std::string file_path)
 	}
 }
 
+static bool make_dir(const std::string& _dir_path)
+{
+#ifdef _WIN32
+	int ret = _mkdir(_dir_path.c_str());
+#else
+	int ret = mkdir(_dir_path.c_str(), 0755);
+#endif
+	return ret == 0 || errno == EEXIST;
+}
+
 void mkd(const std::string& _dir_path)
 {
-	std::string cmd = R"(mkdir ")";
-	cmd += _dir_path;
-	cmd += "\"";
-	system(cmd.c_str());
+	std::string path = remove_unnecessary_slashes(_dir_path);
+	if (make_dir(path) || errno != ENOENT)
+	{
+		return;
+	}
+	for (size_t pos = path.find_first_of(R"(\/)", 1); pos < path.length(); pos = path.find_first_of(R"(\/)", pos + 1))
+	{
+		make_dir(path.substr(0, pos));
+	}
+	make_dir(path);
 }
 
 
@@ -118,133 +185,2179 @@ static EPathType::Type stat_path(std::string _path)
 }
 
 
-static int writer_buf(lua_State *L, const void *p, size_t size, void *sb)
+static long long get_file_size(const std::string& _path)
 {
-	lj_buf_putmem((SBuf *)sb, p, (MSize)size);
-	UNUSED(L);
+	struct stat st;
+	if (0 == stat(_path.c_str(), &st))
+	{
+		return st.st_size;
+	}
 	return 0;
 }
 
-bool DecodeByteCode(lua_State* L, const char* _BCFilePath, const char* _OutputFilePath)
+// Size and modification time (nanoseconds where the platform has them),
+// enough to tell whether a file was rewritten without reading it.
+static bool get_file_stamp(const std::string& _path, long long* _size, long long* _mtime)
 {
-	bool bSuccess = false;
-	size_t sz = 0;
-	const char* decbuf = nullptr;
-	std::ofstream ofs;
+	struct stat st;
+	if (0 != stat(_path.c_str(), &st))
+	{
+		return false;
+	}
+	*_size = st.st_size;
+#if defined(_WIN32)
+	*_mtime = (long long)st.st_mtime * 1000000000LL;
+#elif defined(__APPLE__)
+	*_mtime = (long long)st.st_mtimespec.tv_sec * 1000000000LL + st.st_mtimespec.tv_nsec;
+#else
+	*_mtime = (long long)st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+#endif
+	return true;
+}
+
+
+struct DecOptions
+{
+	bcdec_opts dec = {};
+	bool incremental = false;
+	bool pipeline = false;
+	bool io_uring = false;
+	std::string pack_path;
+	std::string stats_path;
+	std::string strings_path;
+	std::string pool_path;
+	std::string cache_path;
+	std::string profile_path;
+	std::string recover_path;  // Profile written by --recover-opmap.
+	bool list = false;
+	long proto = -1;  // Only decode this prototype, for --proto.
+};
+
+static DecOptions g_Options;
+static BCPackWriter* g_Pack = nullptr;
+static BCStringPool* g_StringPool = nullptr;
+static BCDecCache* g_Cache = nullptr;
+
+
+struct DecResult
+{
+	size_t out_size = 0;
+	uint64_t out_hash = 0;
+	uint64_t in_hash = 0;  // Set when the manifest or the cache needed it.
+	bool hashed = false;
+	bool skipped = false;
+	bool copied = false;
+	bool cached = false;  // The output came from the cache.
+	size_t in_size = 0;
+	double read_seconds = 0.0;
+	double write_seconds = 0.0;
+	bcdec_stats dec = {};
+	std::string error;        // Why the file failed.
+	std::string err_section;  // Dump section of a decode error, if known.
+	size_t err_offset = 0;
+};
+
+
+struct DecStats
+{
+	size_t files = 0;
+	size_t failed = 0;
+	size_t skipped = 0;
+	size_t copied = 0;
+	long long bytes_in = 0;
+	long long bytes_out = 0;
+	double seconds = 0.0;
+};
+
+
+class MappedFile
+{
+public:
+	MappedFile() : data(nullptr), size(0)
+#ifdef _WIN32
+		, mapping(NULL)
+#endif
+	{}
+	~MappedFile() { close(); }
+
+	bool open(const char* _path)
+	{
+		close();
+#ifdef _WIN32
+		HANDLE file = CreateFileA(_path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+		LARGE_INTEGER file_size;
+		if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0)
+		{
+			mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+			if (mapping)
+			{
+				data = (char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+				size = (size_t)file_size.QuadPart;
+			}
+		}
+		CloseHandle(file);
+#else
+		int fd = ::open(_path, O_RDONLY);
+		if (fd < 0)
+		{
+			return false;
+		}
+		struct stat st;
+		if (fstat(fd, &st) == 0 && st.st_size > 0)
+		{
+			void* p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (p != MAP_FAILED)
+			{
+				madvise(p, (size_t)st.st_size, MADV_SEQUENTIAL);
+				data = (char*)p;
+				size = (size_t)st.st_size;
+			}
+		}
+		::close(fd);
+#endif
+		if (!data)
+		{
+			close();
+			return false;
+		}
+		return true;
+	}
 
-	luaL_loadfile(L, _BCFilePath);
+	// Reads one byte of every page, so the page-in happens now rather than
+	// wherever the data is first used.
+	void prefault() const
+	{
+		volatile char sum = 0;
+		for (size_t i = 0; i < size; i += 4096)
+		{
+			sum ^= data[i];
+		}
+		(void)sum;
+	}
 
-	GCfunc *fn = lj_lib_checkfunc(L, 1);
-	static int strip = 1;
-	SBuf *sb = lj_buf_tmp_(L);
-	L->top = L->base + 1;
-	if (!isluafunc(fn) || lj_bcwrite(L, funcproto(fn), writer_buf, sb, strip))
+	void close()
 	{
-		lj_err_caller(L, LJ_ERR_STRDUMP);
-		bSuccess = false;
-		goto exit;
+#ifdef _WIN32
+		if (data)
+		{
+			UnmapViewOfFile(data);
+		}
+		if (mapping)
+		{
+			CloseHandle(mapping);
+		}
+		mapping = NULL;
+#else
+		if (data)
+		{
+			munmap(data, size);
+		}
+#endif
+		data = nullptr;
+		size = 0;
 	}
 
-	setstrV(L, L->top - 1, lj_buf_str(L, sb));
-	lj_gc_check(L);
+	char* data;
+	size_t size;
 
-	decbuf = lua_tolstring(L, -1, &sz);
-	ofs.open(_OutputFilePath, std::ios::binary | std::ios::trunc);
-	ofs.write(decbuf, sz);
-	ofs.close();
-	bSuccess = true;
+private:
+	MappedFile(const MappedFile&);
+	MappedFile& operator=(const MappedFile&);
+#ifdef _WIN32
+	HANDLE mapping;
+#endif
+};
 
-exit:
-	lua_settop(L, 0);
-	return bSuccess;
+
+static double seconds_since(std::chrono::steady_clock::time_point _begin)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - _begin).count();
 }
 
-void DecFileTo_Impl(lua_State* L, const std::string& _In_filepath, const char* _OutputDir)
+static bool WriteOutput(const char* _OutputFilePath, const std::string& _ModuleName, const char* _Data, size_t _Size, DecResult* _Result)
 {
-	std::string fn_stem = get_filename_stem(get_filename_from_path(_In_filepath));
-	std::string OutPath = append_path(_OutputDir, fn_stem) + ".lj";
-	DecodeByteCode(L, _In_filepath.c_str(), OutPath.c_str());
+	if (_Result)
+	{
+		_Result->out_size = _Size;
+		if (g_Options.incremental)
+		{
+			_Result->out_hash = bchash64(_Data, _Size);
+		}
+	}
+	auto begin = std::chrono::steady_clock::now();
+	bool ok;
+	if (g_Pack)
+	{
+		ok = g_Pack->append(_ModuleName, _Data, _Size);
+	}
+	else
+	{
+		// Replaced, not truncated: the old output may be a link to a cache entry.
+		remove(_OutputFilePath);
+		std::ofstream ofs(_OutputFilePath, std::ios::binary | std::ios::trunc);
+		ofs.write(_Data, (std::streamsize)_Size);
+		ofs.close();
+		ok = !ofs.fail();
+	}
+	if (_Result)
+	{
+		_Result->write_seconds = seconds_since(begin);
+		if (!ok)
+		{
+			_Result->error = "cannot write output";
+		}
+	}
+	return ok;
 }
 
-inline void DecSingle(lua_State* L, const char* _InputFilePath, const char* _OutputDir)
+static bool ReadWholeFile(const char* _path, std::vector<char>& _buf)
 {
-	mkd(_OutputDir);
-	DecFileTo_Impl(L, _InputFilePath, _OutputDir);
+	std::ifstream ifs(_path, std::ios::binary);
+	if (!ifs)
+	{
+		return false;
+	}
+	_buf.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+	return !ifs.bad();
 }
 
-void DecDirectory(lua_State* L, const char* _InputDir, const char* _OutputDir)
+// Copies a file without passing it through user space where the OS allows.
+static bool CopyFileFast(const char* _src, const char* _dst)
 {
-	mkd(_OutputDir);
+	remove(_dst);
+#ifdef _WIN32
+	return CopyFileA(_src, _dst, FALSE) != 0;
+#else
+	int in = ::open(_src, O_RDONLY);
+	if (in < 0)
+	{
+		return false;
+	}
+	int out = ::open(_dst, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (out < 0)
+	{
+		::close(in);
+		return false;
+	}
+	bool ok = true;
+	bool kernel = true;
+	for (;;)
+	{
+		ssize_t n = -1;
+#ifdef __linux__
+		if (kernel)
+		{
+			n = copy_file_range(in, nullptr, out, nullptr, 1 << 30, 0);
+			if (n < 0 && (errno == ENOSYS || errno == EXDEV || errno == EINVAL || errno == EOPNOTSUPP))
+			{
+				n = sendfile(out, in, nullptr, 1 << 30);
+			}
+			if (n < 0 && (errno == ENOSYS || errno == EINVAL))
+			{
+				kernel = false;
+			}
+		}
+#else
+		kernel = false;
+#endif
+		if (!kernel)
+		{
+			char buf[65536];
+			n = ::read(in, buf, sizeof(buf));
+			if (n > 0 && ::write(out, buf, (size_t)n) != n)
+			{
+				n = -1;
+			}
+		}
+		if (n <= 0)
+		{
+			ok = n == 0;
+			break;
+		}
+	}
+	::close(in);
+	return ::close(out) == 0 && ok;
+#endif
+}
 
-	_finddata_t fileinf;
-	long handle = _findfirst(append_path(_InputDir, "*").c_str(), &fileinf);
-	do
+// Produces the output from a cache entry: a link, or a copy when links are
+// refused, or the entry's bytes for the pack.
+static bool FetchCached(const std::string& _Entry, const char* _OutputFilePath, const std::string& _ModuleName, DecResult* _Result)
+{
+	if (g_Pack)
+	{
+		std::vector<char> buf;
+		if (!ReadWholeFile(_Entry.c_str(), buf))
+		{
+			return false;
+		}
+		if (_Result)
+		{
+			_Result->cached = true;
+		}
+		return WriteOutput(_OutputFilePath, _ModuleName, buf.data(), buf.size(), _Result);
+	}
+	auto begin = std::chrono::steady_clock::now();
+	if (!g_Cache->link(_Entry, _OutputFilePath) && !CopyFileFast(_Entry.c_str(), _OutputFilePath))
 	{
-		if (fileinf.attrib != _A_SUBDIR)
+		return false;
+	}
+	if (_Result)
+	{
+		struct stat st;
+		_Result->cached = true;
+		_Result->out_size = stat(_Entry.c_str(), &st) == 0 ? (size_t)st.st_size : 0;
+		if (g_Options.incremental)
 		{
-			std::cout << fileinf.name << std::endl;
-			std::string file_path = append_path(_InputDir, fileinf.name);
-			DecFileTo_Impl(L, file_path, _OutputDir);
+			bchash64_file(_Entry, &_Result->out_hash);
+		}
+		_Result->write_seconds = seconds_since(begin);
+	}
+	return true;
+}
 
+// Publishes a fresh output in the cache and links the output to it, so the
+// bytes are written once. Returns false if that fails; the caller writes
+// the output itself.
+static bool StoreCached(uint64_t _InHash, size_t _InSize, const char* _OutputFilePath, const char* _Data, size_t _Size, DecResult* _Result)
+{
+	auto begin = std::chrono::steady_clock::now();
+	std::string entry;
+	if (!g_Cache->store(_InHash, _InSize, _Data, _Size, &entry) || g_Pack || !g_Cache->link(entry, _OutputFilePath))
+	{
+		return false;
+	}
+	if (_Result)
+	{
+		_Result->out_size = _Size;
+		if (g_Options.incremental)
+		{
+			_Result->out_hash = bchash64(_Data, _Size);
 		}
-	} while (!_findnext(handle, &fileinf));
-	_findclose(handle);
+		_Result->write_seconds = seconds_since(begin);
+	}
+	return true;
 }
 
+struct StringCollector
+{
+	BCFileStrings fs;
+	std::unordered_map<const char*, uint32_t> index;  // Interned strings of one dump are unique by address.
+};
 
-int main(int _argc, char **_argv)
+static void collect_string(void* ud, const char* s, size_t len, int kind)
+{
+	StringCollector* c = (StringCollector*)ud;
+	auto ins = c->index.insert(std::make_pair(s, (uint32_t)c->fs.strs.size()));
+	if (ins.second)
+	{
+		c->fs.strs.emplace_back(s, len);
+		c->fs.uses.push_back(0);
+		c->fs.kinds.push_back(0);
+	}
+	c->fs.uses[ins.first->second]++;
+	c->fs.kinds[ins.first->second] |= (uint8_t)(1 << kind);
+}
+
+static void CollectStrings(bcdec_ctx* ctx, const std::string& _ModuleName, const char* _Data, size_t _Size)
+{
+	StringCollector c;
+	if (bcdec_strings(ctx, _Data, _Size, collect_string, &c) == BCDEC_OK)
+	{
+		g_StringPool->add_file(_ModuleName, c.fs);
+	}
+}
+
+static void SetDecodeError(bcdec_ctx* ctx, DecResult* _Result)
+{
+	const char* section;
+	size_t offset;
+	_Result->error = bcdec_errmsg(ctx);
+	if (bcdec_errpos(ctx, &section, &offset))
+	{
+		_Result->err_section = section;
+		_Result->err_offset = offset;
+	}
+}
+
+static int sink_append(void* ud, const void* p, size_t n)
 {
-	lua_State *L = lua_open();
+	std::vector<char>* out = (std::vector<char>*)ud;
+	out->insert(out->end(), (const char*)p, (const char*)p + n);
+	return 0;
+}
 
-	switch (_argc)
+static std::string get_module_name(const std::string& _RelPath)
+{
+	std::string name = get_filename_stem(get_filename_from_path(_RelPath));
+	size_t slash_pos = _RelPath.find_last_of(R"(\/)");
+	if (slash_pos < _RelPath.length())
 	{
-	case 2:
+		name = _RelPath.substr(0, slash_pos + 1) + name;
+	}
+	std::replace(name.begin(), name.end(), '\\', '/');
+	return name;
+}
+
+class DecManifest
+{
+public:
+	DecManifest() : version_ok(false), unchanged(0), removed(0) {}
+
+	void load(const std::string& _path, const std::string& _version)
 	{
-		auto st = stat_path(_argv[1]);
-		if (st == EPathType::Invalid)
+		std::ifstream ifs(_path.c_str());
+		std::string line;
+		if (!std::getline(ifs, line) || line.compare(0, 15, "bcdec-manifest ") != 0)
 		{
-			std::cout << "Invalid input path." << std::endl;
-			break;
+			return;
 		}
-		if (st == EPathType::Directory)
+		version_ok = line.substr(15) == _version;
+		while (std::getline(ifs, line))
 		{
-			std::string outdir = append_path(_argv[1], "dec");
-			DecDirectory(L, _argv[1], outdir.c_str());
+			// in_hash out_hash out_size out_mtime path
+			ManifestEntry e;
+			char* end;
+			if (line.length() < 35 || line[16] != ' ' || line[33] != ' ' ||
+				!bchash_parse(line.substr(0, 16), &e.in_hash) ||
+				!bchash_parse(line.substr(17, 16), &e.out_hash))
+			{
+				continue;
+			}
+			e.out_size = strtoll(line.c_str() + 34, &end, 10);
+			if (*end != ' ')
+			{
+				continue;
+			}
+			e.out_mtime = strtoll(end + 1, &end, 10);
+			if (*end != ' ' || !end[1])
+			{
+				continue;
+			}
+			old_entries[end + 1] = e;
 		}
-		else
+	}
+
+	bool save(const std::string& _path, const std::string& _version)
+	{
+		std::vector<std::string> keys;
+		for (auto it = new_entries.begin(); it != new_entries.end(); ++it)
+		{
+			keys.push_back(it->first);
+		}
+		std::sort(keys.begin(), keys.end());
+		std::string tmp_path = _path + ".tmp";
+		std::ofstream ofs(tmp_path.c_str(), std::ios::trunc);
+		ofs << "bcdec-manifest " << _version << '\n';
+		for (size_t i = 0; i < keys.size(); ++i)
+		{
+			const ManifestEntry& e = new_entries[keys[i]];
+			ofs << bchash_hex(e.in_hash) << ' ' << bchash_hex(e.out_hash) << ' ' << e.out_size << ' ' << e.out_mtime << ' ' << keys[i] << '\n';
+		}
+		ofs.close();
+		if (ofs.fail())
 		{
-			std::string outdir = append_path(get_parent_path(_argv[1]), "dec");
-			DecSingle(L, _argv[1], outdir.c_str());
+			::remove(tmp_path.c_str());
+			return false;
 		}
+		::remove(_path.c_str());
+		return ::rename(tmp_path.c_str(), _path.c_str()) == 0;
+	}
 
-		break;
+	// Marks an input found by the directory walk as present, before it is
+	// read, so a file that fails to read keeps its output.
+	void found(const std::string& _RelPath)
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		seen.insert(get_module_name(_RelPath));
 	}
-	case 3:
+
+	// Returns whether the output is current: the input hash is unchanged and
+	// the output still has the size and mtime it was written with.
+	bool check(const std::string& _RelPath, uint64_t _InHash, const std::string& _OutPath)
 	{
-		auto st = stat_path(_argv[1]);
-		if (st == EPathType::Invalid)
+		ManifestEntry e;
 		{
-			std::cout << "Invalid input path." << std::endl;
-			break;
+			std::lock_guard<std::mutex> lock(mtx);
+			auto it = old_entries.find(_RelPath);
+			if (!version_ok || it == old_entries.end() || it->second.in_hash != _InHash)
+			{
+				return false;
+			}
+			e = it->second;
 		}
-		if (st == EPathType::Directory)
+		long long size, mtime;
+		if (!get_file_stamp(_OutPath, &size, &mtime) || size != e.out_size || mtime != e.out_mtime)
 		{
-			DecDirectory(L, _argv[1], _argv[2]);
+			return false;
 		}
-		else
+		std::lock_guard<std::mutex> lock(mtx);
+		new_entries[_RelPath] = e;
+		unchanged++;
+		return true;
+	}
+
+	// Called once the output is written. An output that cannot be stat'ed
+	// is left out, so the next run decodes it again.
+	void record(const std::string& _RelPath, uint64_t _InHash, uint64_t _OutHash, const std::string& _OutPath)
+	{
+		ManifestEntry e;
+		e.in_hash = _InHash;
+		e.out_hash = _OutHash;
+		if (!get_file_stamp(_OutPath, &e.out_size, &e.out_mtime))
 		{
-			DecSingle(L, _argv[1], _argv[2]);
+			return;
 		}
-		break;
+		std::lock_guard<std::mutex> lock(mtx);
+		new_entries[_RelPath] = e;
 	}
 
-	default:
+	// Deletes the outputs of inputs the directory walk did not find.
+	void remove_vanished(const std::string& _OutputDir)
 	{
-		std::cout << R"(Usage: bcDec "InputFilePath/InputDir" ["OutputDir"])" << std::endl;
+		for (auto it = old_entries.begin(); it != old_entries.end(); ++it)
+		{
+			std::string module = get_module_name(it->first);
+			if (seen.count(module))
+			{
+				continue;
+			}
+			seen.insert(module);
+			if (::remove(append_path(_OutputDir, module + ".lj").c_str()) == 0)
+			{
+				removed++;
+			}
+		}
 	}
-	break;
+
+	void print_summary() const
+	{
+		printf("incremental: %u decoded, %u unchanged, %u removed\n",
+			(unsigned)(new_entries.size() - unchanged), (unsigned)unchanged, (unsigned)removed);
 	}
 
-	lua_close(L);
-	return 0;
-}
\ No newline at end of file
+private:
+	struct ManifestEntry
+	{
+		uint64_t in_hash = 0;
+		uint64_t out_hash = 0;
+		long long out_size = 0;
+		long long out_mtime = 0;
+	};
+
+	bool version_ok;
+	size_t unchanged;
+	size_t removed;
+	std::unordered_map<std::string, ManifestEntry> old_entries;
+	std::unordered_map<std::string, ManifestEntry> new_entries;
+	std::unordered_set<std::string> seen;
+	std::mutex mtx;
+};
+
+static DecManifest* g_Manifest = nullptr;
+
+// _RelPath is the manifest key: with -i, an input whose output is current
+// is only hashed and _Result->skipped is set.
+bool DecodeByteCode(bcdec_ctx* ctx, const char* _BCFilePath, const char* _OutputFilePath, const std::string& _RelPath, DecResult* _Result = nullptr)
+{
+	MappedFile mf;
+	std::vector<char> filebuf;
+	const char* data = nullptr;
+	size_t size = 0;
+	auto read_begin = std::chrono::steady_clock::now();
+	if (mf.open(_BCFilePath))
+	{
+		data = mf.data;
+		size = mf.size;
+		// With stats on, the page faults are counted as read time, not bcread time.
+		if (g_Options.dec.stats)
+		{
+			mf.prefault();
+		}
+	}
+	else if (ReadWholeFile(_BCFilePath, filebuf))
+	{
+		data = filebuf.data();
+		size = filebuf.size();
+	}
+	else
+	{
+		if (_Result)
+		{
+			_Result->error = "cannot read input";
+		}
+		return false;
+	}
+	if (_Result)
+	{
+		_Result->in_size = size;
+		_Result->read_seconds = seconds_since(read_begin);
+	}
+
+	uint64_t in_hash = 0;
+	if (g_Manifest || g_Cache)
+	{
+		in_hash = bchash64(data, size);
+		if (_Result)
+		{
+			_Result->in_hash = in_hash;
+			_Result->hashed = true;
+		}
+	}
+	if (g_Manifest && g_Manifest->check(_RelPath, in_hash, _OutputFilePath))
+	{
+		if (_Result)
+		{
+			_Result->skipped = true;
+		}
+		return true;
+	}
+
+	std::string module_name = get_module_name(_RelPath);
+	if (g_StringPool)
+	{
+		CollectStrings(ctx, module_name, data, size);
+	}
+
+	if (!g_Pack && bcdec_probe(data, size) == BCDEC_KIND_STANDARD)
+	{
+		if (_Result)
+		{
+			_Result->out_size = size;
+			_Result->copied = true;
+			if (g_Options.incremental)
+			{
+				_Result->out_hash = bchash64(data, size);
+			}
+		}
+		auto begin = std::chrono::steady_clock::now();
+		bool ok = CopyFileFast(_BCFilePath, _OutputFilePath);
+		if (_Result)
+		{
+			_Result->write_seconds = seconds_since(begin);
+			if (!ok)
+			{
+				_Result->error = "cannot write output";
+			}
+		}
+		return ok;
+	}
+
+	if (g_Cache)
+	{
+		std::string entry;
+		if (g_Cache->lookup(in_hash, size, &entry) && FetchCached(entry, _OutputFilePath, module_name, _Result))
+		{
+			return true;
+		}
+	}
+
+	std::vector<char> out;
+	out.reserve(size + size / 2);
+	bcdec_sink sink = {};
+	sink.write = sink_append;
+	sink.ud = &out;
+	int status = bcdec_decode(ctx, data, size, &sink, &g_Options.dec);
+	if (_Result && g_Options.dec.stats)
+	{
+		_Result->dec = *bcdec_last_stats(ctx);
+	}
+	if (status != BCDEC_OK)
+	{
+		if (_Result)
+		{
+			SetDecodeError(ctx, _Result);
+		}
+		return false;
+	}
+	if (g_Cache && StoreCached(in_hash, size, _OutputFilePath, out.data(), out.size(), _Result))
+	{
+		return true;
+	}
+	return WriteOutput(_OutputFilePath, module_name, out.data(), out.size(), _Result);
+}
+
+struct DecTask
+{
+	std::string in_path;
+	std::string out_dir;
+	std::string rel_path;
+};
+
+
+static std::string get_output_path(const std::string& _OutputDir, const std::string& _In_filepath)
+{
+	return append_path(_OutputDir, get_filename_stem(get_filename_from_path(_In_filepath))) + ".lj";
+}
+
+bool DecFileTo_Impl(bcdec_ctx* ctx, const std::string& _In_filepath, const char* _OutputDir, const std::string& _RelPath, DecResult* _Result = nullptr)
+{
+	std::string OutPath = get_output_path(_OutputDir, _In_filepath);
+	return DecodeByteCode(ctx, _In_filepath.c_str(), OutPath.c_str(), _RelPath, _Result);
+}
+
+
+static std::string get_decoder_version()
+{
+	std::string version = "bcDec " BCDEC_VERSION;
+	version += g_Options.dec.transcode ? " transcode" : " bcwrite";
+	version += g_Options.dec.verify ? " verify" : "";
+	version += LJ_FR2 ? " fr2" : " fr1";
+	if (!g_Options.profile_path.empty())
+	{
+		std::vector<char> text(bcdec_profile_text(nullptr, 0) + 1);
+		bcdec_profile_text(text.data(), text.size());
+		version += " profile " + bchash_hex(bchash64(text.data(), text.size() - 1));
+	}
+	return version;
+}
+
+// Per-file timings and sizes for --stats, written as JSON lines, plus the
+// totals behind the summary table.
+class DecStatsLog
+{
+public:
+	DecStatsLog() : files(0), failed(0), skipped(0), copied(0), bytes_in(0), bytes_out(0),
+		protos(0), strings(0), string_bytes(0), peak_mem(0) {}
+
+	bool open(const std::string& _path)
+	{
+		ofs.open(_path.c_str(), std::ios::trunc);
+		return ofs.is_open();
+	}
+
+	void record(const std::string& _RelPath, const DecResult& _res, bool _ok)
+	{
+		const char* status = _res.skipped ? "skipped" : (!_ok ? "failed" : (_res.copied ? "copied" : (_res.cached ? "cached" : "ok")));
+		double times[PHASE_COUNT] = { _res.read_seconds, _res.dec.bcread_seconds, _res.dec.bcwrite_seconds, _res.write_seconds };
+		char line[512];
+		snprintf(line, sizeof(line),
+			"\"status\":\"%s\",\"bytes_in\":%llu,\"bytes_out\":%llu,"
+			"\"read_ms\":%.3f,\"bcread_ms\":%.3f,\"bcwrite_ms\":%.3f,\"write_ms\":%.3f,"
+			"\"protos\":%u,\"strings\":%u,\"string_bytes\":%llu,\"peak_mem\":%llu}",
+			status, (unsigned long long)_res.in_size, (unsigned long long)(_ok ? _res.out_size : 0),
+			times[0] * 1e3, times[1] * 1e3, times[2] * 1e3, times[3] * 1e3,
+			_res.dec.protos, _res.dec.strings, (unsigned long long)_res.dec.string_bytes, (unsigned long long)_res.dec.peak_mem);
+		std::string json = "{\"file\":";
+		append_json_string(json, _RelPath);
+		json += ',';
+		if (!_ok)
+		{
+			json += "\"error\":";
+			append_json_string(json, _res.error);
+			json += ',';
+			if (!_res.err_section.empty())
+			{
+				json += "\"section\":\"" + _res.err_section + "\",\"offset\":" + std::to_string(_res.err_offset) + ',';
+			}
+		}
+		json += line;
+		json += '\n';
+
+		std::lock_guard<std::mutex> lock(mtx);
+		ofs << json;
+		files++;
+		failed += !_ok;
+		skipped += _res.skipped;
+		copied += _ok && _res.copied;
+		bytes_in += _res.in_size;
+		bytes_out += _ok ? _res.out_size : 0;
+		protos += _res.dec.protos;
+		strings += _res.dec.strings;
+		string_bytes += _res.dec.string_bytes;
+		peak_mem = std::max(peak_mem, (unsigned long long)_res.dec.peak_mem);
+		for (int i = 0; i < PHASE_COUNT; ++i)
+		{
+			phases[i].total += times[i];
+			if (times[i] > phases[i].max)
+			{
+				phases[i].max = times[i];
+				phases[i].max_file = _RelPath;
+			}
+		}
+	}
+
+	void print_summary()
+	{
+		static const char* names[PHASE_COUNT] = { "read", "bcread", "bcwrite", "write" };
+		ofs.close();
+		double sum = 0.0;
+		for (int i = 0; i < PHASE_COUNT; ++i)
+		{
+			sum += phases[i].total;
+		}
+		size_t timed = std::max<size_t>(1, files - skipped);
+		printf("%-8s %10s %7s %10s %10s  %s\n", "phase", "total s", "share", "mean ms", "max ms", "slowest file");
+		for (int i = 0; i < PHASE_COUNT; ++i)
+		{
+			const Phase& ph = phases[i];
+			printf("%-8s %10.3f %6.1f%% %10.3f %10.3f  %s\n", names[i], ph.total,
+				sum > 0.0 ? ph.total * 100.0 / sum : 0.0, ph.total * 1e3 / timed, ph.max * 1e3, ph.max_file.c_str());
+		}
+		printf("files %u (%u failed, %u unchanged, %u copied), %.2f MB in, %.2f MB out\n",
+			(unsigned)files, (unsigned)failed, (unsigned)skipped, (unsigned)copied, bytes_in / 1048576.0, bytes_out / 1048576.0);
+		printf("%llu prototypes, %llu string constants (%.2f MB), peak lua_State memory %.2f MB\n",
+			protos, strings, string_bytes / 1048576.0, peak_mem / 1048576.0);
+	}
+
+private:
+	enum { PHASE_COUNT = 4 };
+
+	struct Phase
+	{
+		double total = 0.0;
+		double max = 0.0;
+		std::string max_file;
+	};
+
+	static void append_json_string(std::string& _out, const std::string& _str)
+	{
+		_out += '"';
+		for (size_t i = 0; i < _str.length(); ++i)
+		{
+			unsigned char c = (unsigned char)_str[i];
+			if (c == '"' || c == '\\')
+			{
+				_out += '\\';
+				_out += (char)c;
+			}
+			else if (c < 0x20)
+			{
+				char esc[8];
+				snprintf(esc, sizeof(esc), "\\u%04x", c);
+				_out += esc;
+			}
+			else
+			{
+				_out += (char)c;
+			}
+		}
+		_out += '"';
+	}
+
+	std::ofstream ofs;
+	std::mutex mtx;
+	Phase phases[PHASE_COUNT];
+	size_t files;
+	size_t failed;
+	size_t skipped;
+	size_t copied;
+	unsigned long long bytes_in;
+	unsigned long long bytes_out;
+	unsigned long long protos;
+	unsigned long long strings;
+	unsigned long long string_bytes;
+	unsigned long long peak_mem;
+};
+
+static DecStatsLog* g_StatsLog = nullptr;
+static std::mutex g_PrintMutex;
+
+// A failed file is reported on stderr and the batch goes on.
+static void ReportFailure(const std::string& _RelPath, const DecResult& _res)
+{
+	std::lock_guard<std::mutex> lock(g_PrintMutex);
+	std::cerr << _RelPath << ": " << (_res.error.empty() ? "failed" : _res.error) << '\n';
+}
+
+static bool DecFile(bcdec_ctx* ctx, const DecTask& _task, DecResult* _Result)
+{
+	bool ok = DecFileTo_Impl(ctx, _task.in_path, _task.out_dir.c_str(), _task.rel_path, _Result);
+	if (ok && _Result->skipped)
+	{
+		if (g_StatsLog)
+		{
+			g_StatsLog->record(_task.rel_path, *_Result, true);
+		}
+		return true;
+	}
+	{
+		std::lock_guard<std::mutex> lock(g_PrintMutex);
+		std::cout << _task.rel_path << '\n';
+	}
+	if (!ok)
+	{
+		ReportFailure(_task.rel_path, *_Result);
+	}
+	if (g_StatsLog)
+	{
+		g_StatsLog->record(_task.rel_path, *_Result, ok);
+	}
+	if (!ok)
+	{
+		return false;
+	}
+	if (g_Manifest && _Result->hashed)
+	{
+		g_Manifest->record(_task.rel_path, _Result->in_hash, _Result->out_hash, get_output_path(_task.out_dir, _task.in_path));
+	}
+	return true;
+}
+
+inline bool DecSingle(bcdec_ctx* ctx, const char* _InputFilePath, const char* _OutputDir)
+{
+	if (!g_Pack)
+	{
+		mkd(_OutputDir);
+	}
+	DecResult res;
+	return DecFile(ctx, DecTask{ _InputFilePath, _OutputDir, get_filename_from_path(_InputFilePath) }, &res);
+}
+
+static bool is_same_path(const std::string& _lhs, const std::string& _rhs)
+{
+	std::string l = remove_unnecessary_slashes(_lhs);
+	std::string r = remove_unnecessary_slashes(_rhs);
+	std::replace(l.begin(), l.end(), '/', '\\');
+	std::replace(r.begin(), r.end(), '/', '\\');
+	return l == r;
+}
+
+
+template<typename T>
+class BoundedQueue
+{
+public:
+	explicit BoundedQueue(size_t _capacity) : capacity(_capacity), closed(false) {}
+
+	void push(T&& _item)
+	{
+		std::unique_lock<std::mutex> lock(mtx);
+		cv_not_full.wait(lock, [this]() { return items.size() < capacity; });
+		items.push_back(std::move(_item));
+		cv_not_empty.notify_one();
+	}
+
+	bool pop(T& _item)
+	{
+		std::unique_lock<std::mutex> lock(mtx);
+		cv_not_empty.wait(lock, [this]() { return !items.empty() || closed; });
+		if (items.empty())
+		{
+			return false;
+		}
+		_item = std::move(items.front());
+		items.pop_front();
+		cv_not_full.notify_one();
+		return true;
+	}
+
+	// Waits for at least one item, then takes up to _max without waiting again.
+	bool pop_some(std::vector<T>& _items, size_t _max)
+	{
+		_items.clear();
+		std::unique_lock<std::mutex> lock(mtx);
+		cv_not_empty.wait(lock, [this]() { return !items.empty() || closed; });
+		while (!items.empty() && _items.size() < _max)
+		{
+			_items.push_back(std::move(items.front()));
+			items.pop_front();
+		}
+		cv_not_full.notify_all();
+		return !_items.empty();
+	}
+
+	void close()
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		closed = true;
+		cv_not_empty.notify_all();
+	}
+
+private:
+	size_t capacity;
+	bool closed;
+	std::deque<T> items;
+	std::mutex mtx;
+	std::condition_variable cv_not_empty;
+	std::condition_variable cv_not_full;
+};
+
+typedef BoundedQueue<DecTask> DecTaskQueue;
+
+
+template<typename FnEntry>
+static void ForEachDirEntry(const std::string& _Dir, FnEntry _fn)
+{
+#ifdef _WIN32
+	_finddata_t fileinf;
+	intptr_t handle = _findfirst(append_path(_Dir, "*").c_str(), &fileinf);
+	if (handle == -1)
+	{
+		return;
+	}
+	do
+	{
+		_fn(std::string(fileinf.name), (fileinf.attrib & _A_SUBDIR) != 0);
+	} while (!_findnext(handle, &fileinf));
+	_findclose(handle);
+#else
+	DIR* dir = opendir(_Dir.c_str());
+	if (!dir)
+	{
+		return;
+	}
+	while (struct dirent* ent = readdir(dir))
+	{
+		std::string name = ent->d_name;
+		bool is_dir;
+		if (ent->d_type == DT_UNKNOWN || ent->d_type == DT_LNK)
+		{
+			is_dir = stat_path(append_path(_Dir, name)) == EPathType::Directory;
+		}
+		else
+		{
+			is_dir = ent->d_type == DT_DIR;
+		}
+		_fn(name, is_dir);
+	}
+	closedir(dir);
+#endif
+}
+
+template<typename FnVisit>
+static void WalkDirectory(const std::string& _InputDir, const std::string& _OutputDir,
+	const std::string& _RelDir, const std::string& _SkipDir, FnVisit& _visit)
+{
+	ForEachDirEntry(_InputDir, [&](const std::string& _name, bool _is_dir)
+	{
+		if (_name == "." || _name == "..")
+		{
+			return;
+		}
+		std::string in_path = append_path(_InputDir, _name);
+		std::string rel_path = _RelDir.empty() ? _name : append_path(_RelDir, _name);
+		if (_is_dir)
+		{
+			if (is_same_path(in_path, _SkipDir))
+			{
+				return;
+			}
+			std::string out_dir = append_path(_OutputDir, _name);
+			if (!g_Pack)
+			{
+				mkd(out_dir);
+			}
+			WalkDirectory(in_path, out_dir, rel_path, _SkipDir, _visit);
+		}
+		else
+		{
+			if (g_Manifest)
+			{
+				g_Manifest->found(rel_path);
+			}
+			_visit(DecTask{ in_path, _OutputDir, rel_path });
+		}
+	});
+}
+
+// Returns the number of files that failed.
+static size_t PrintWorkerStats(const std::vector<DecStats>& _stats, double _wall_seconds)
+{
+	DecStats total;
+	for (size_t i = 0; i < _stats.size(); ++i)
+	{
+		const DecStats& st = _stats[i];
+		double secs = st.seconds > 0.0 ? st.seconds : 1e-9;
+		printf("worker %2u: %6u files, %4u failed, %6u unchanged, %6u copied, %10.2f MB in, %10.2f MB out, %8.1f files/s, %8.2f MB/s\n",
+			(unsigned)i, (unsigned)st.files, (unsigned)st.failed, (unsigned)st.skipped, (unsigned)st.copied,
+			st.bytes_in / 1048576.0, st.bytes_out / 1048576.0,
+			st.files / secs, st.bytes_in / 1048576.0 / secs);
+		total.files += st.files;
+		total.failed += st.failed;
+		total.skipped += st.skipped;
+		total.copied += st.copied;
+		total.bytes_in += st.bytes_in;
+		total.bytes_out += st.bytes_out;
+	}
+	double wall = _wall_seconds > 0.0 ? _wall_seconds : 1e-9;
+	printf("total    : %6u files, %4u failed, %6u unchanged, %6u copied, %10.2f MB in, %10.2f MB out, %8.1f files/s, %8.2f MB/s (%.3f s)\n",
+		(unsigned)total.files, (unsigned)total.failed, (unsigned)total.skipped, (unsigned)total.copied,
+		total.bytes_in / 1048576.0, total.bytes_out / 1048576.0,
+		total.files / wall, total.bytes_in / 1048576.0 / wall, _wall_seconds);
+	return total.failed;
+}
+
+// One file on its way through the pipeline. io holds the input until the
+// decode stage replaces it with the output.
+struct DecItem
+{
+	DecTask task;
+	BCFileIO io;
+	DecResult res;
+	size_t worker = 0;
+	uint64_t in_hash = 0;
+	bool hashed = false;
+	bool ok = false;
+};
+
+static const size_t PIPE_BATCH = 32;
+
+// Overlaps reading, decoding and writing: one reader thread, _Jobs decoder
+// threads and one writer thread, joined by bounded queues.
+static size_t DecDirectoryPipelined(const char* _InputDir, const char* _OutputDir, unsigned _Jobs)
+{
+	DecTaskQueue tasks(PIPE_BATCH * 4);
+	BoundedQueue<DecItem> decode_queue(_Jobs * 8 + PIPE_BATCH);
+	BoundedQueue<DecItem> write_queue(_Jobs * 8 + PIPE_BATCH);
+	std::vector<DecStats> stats(_Jobs);
+	double read_seconds = 0.0;
+	double write_seconds = 0.0;
+	bool ring_read = false;
+	bool ring_write = false;
+	auto wall_begin = std::chrono::steady_clock::now();
+
+	std::thread reader([&]()
+	{
+		BCRing ring;
+		ring_read = g_Options.io_uring && ring.init(PIPE_BATCH * 2);
+		std::vector<DecTask> batch;
+		std::vector<BCFileIO> io;
+		while (tasks.pop_some(batch, PIPE_BATCH))
+		{
+			auto begin = std::chrono::steady_clock::now();
+			io.resize(batch.size());
+			for (size_t i = 0; i < batch.size(); ++i)
+			{
+				io[i].path = batch[i].in_path;
+			}
+			ring.read_files(io.data(), io.size());
+			double secs = seconds_since(begin);
+			read_seconds += secs;
+			for (size_t i = 0; i < batch.size(); ++i)
+			{
+				DecItem item;
+				item.task = std::move(batch[i]);
+				item.io = std::move(io[i]);
+				// A batch is read as a whole, so each file gets an equal share.
+				item.res.read_seconds = secs / batch.size();
+				decode_queue.push(std::move(item));
+			}
+		}
+		decode_queue.close();
+	});
+
+	std::atomic<unsigned> decoders_left(_Jobs);
+	std::vector<std::thread> decoders;
+	for (unsigned w = 0; w < _Jobs; ++w)
+	{
+		decoders.emplace_back([&, w]()
+		{
+			bcdec_ctx* wctx = bcdec_new();
+			double busy = 0.0;
+			std::vector<char> out;
+			DecItem item;
+			while (decode_queue.pop(item))
+			{
+				auto begin = std::chrono::steady_clock::now();
+				item.worker = w;
+				item.res.in_size = item.io.data.size();
+				std::string out_path = get_output_path(item.task.out_dir, item.task.in_path);
+				const char* data = item.io.data.data();
+				size_t size = item.io.data.size();
+				if (!item.io.ok)
+				{
+					item.res.error = "cannot read input";
+				}
+				if (item.io.ok && (g_Manifest || g_Cache))
+				{
+					item.in_hash = bchash64(data, size);
+					item.hashed = true;
+				}
+				if (item.io.ok && g_Manifest)
+				{
+					item.res.skipped = g_Manifest->check(item.task.rel_path, item.in_hash, out_path);
+				}
+				if (item.io.ok && !item.res.skipped)
+				{
+					{
+						std::lock_guard<std::mutex> lock(g_PrintMutex);
+						std::cout << item.task.rel_path << '\n';
+					}
+					if (g_StringPool)
+					{
+						CollectStrings(wctx, get_module_name(item.task.rel_path), data, size);
+					}
+					std::string entry;
+					if (bcdec_probe(data, size) == BCDEC_KIND_STANDARD)
+					{
+						item.res.copied = !g_Pack;
+						item.ok = true;
+					}
+					else if (g_Cache && g_Cache->lookup(item.in_hash, size, &entry))
+					{
+						// A link is a metadata operation, so it is made here rather than in the writer.
+						if (g_Pack)
+						{
+							item.ok = ReadWholeFile(entry.c_str(), out);
+							item.io.data.swap(out);
+							item.res.cached = item.ok;
+						}
+						else
+						{
+							item.ok = FetchCached(entry, out_path.c_str(), std::string(), &item.res);
+						}
+						if (!item.ok)
+						{
+							item.res.error = "cannot read cache entry";
+						}
+					}
+					else
+					{
+						out.clear();
+						out.reserve(size + size / 2);
+						bcdec_sink sink = {};
+						sink.write = sink_append;
+						sink.ud = &out;
+						item.ok = bcdec_decode(wctx, data, size, &sink, &g_Options.dec) == BCDEC_OK;
+						if (!item.ok)
+						{
+							SetDecodeError(wctx, &item.res);
+						}
+						if (g_Options.dec.stats)
+						{
+							item.res.dec = *bcdec_last_stats(wctx);
+						}
+						item.io.data.swap(out);
+					}
+					if (!item.res.cached || g_Pack)
+					{
+						item.res.out_size = item.io.data.size();
+					}
+					if (item.ok && g_Options.incremental && (!item.res.cached || g_Pack))
+					{
+						item.res.out_hash = bchash64(item.io.data.data(), item.io.data.size());
+					}
+				}
+				item.io.path = out_path;
+				busy += seconds_since(begin);
+				write_queue.push(std::move(item));
+			}
+			stats[w].seconds = busy;
+			bcdec_free(wctx);
+			if (--decoders_left == 0)
+			{
+				write_queue.close();
+			}
+		});
+	}
+
+	std::thread writer([&]()
+	{
+		BCRing ring;
+		ring_write = g_Options.io_uring && !g_Pack && ring.init(PIPE_BATCH * 2);
+		std::vector<DecItem> batch;
+		std::vector<BCFileIO> io;
+		std::vector<size_t> slots;
+		while (write_queue.pop_some(batch, PIPE_BATCH))
+		{
+			auto begin = std::chrono::steady_clock::now();
+			io.clear();
+			slots.clear();
+			for (size_t i = 0; i < batch.size(); ++i)
+			{
+				DecItem& item = batch[i];
+				if (!item.ok || (item.res.cached && !g_Pack))
+				{
+					continue;
+				}
+				if (g_Cache && item.hashed && !item.res.copied && !item.res.cached)
+				{
+					const std::vector<char>& out = item.io.data;
+					if (StoreCached(item.in_hash, item.res.in_size, item.io.path.c_str(), out.data(), out.size(), nullptr))
+					{
+						continue;
+					}
+				}
+				if (g_Pack)
+				{
+					item.ok = g_Pack->append(get_module_name(item.task.rel_path), item.io.data.data(), item.io.data.size());
+					if (!item.ok)
+					{
+						item.res.error = "cannot write output";
+					}
+					continue;
+				}
+				slots.push_back(i);
+				io.push_back(std::move(item.io));
+			}
+			ring.write_files(io.data(), io.size());
+			for (size_t i = 0; i < slots.size(); ++i)
+			{
+				batch[slots[i]].ok = io[i].ok;
+				if (!io[i].ok)
+				{
+					batch[slots[i]].res.error = "cannot write output";
+				}
+			}
+			double secs = seconds_since(begin);
+			write_seconds += secs;
+			for (size_t i = 0; i < batch.size(); ++i)
+			{
+				DecItem& item = batch[i];
+				DecStats& st = stats[item.worker];
+				item.res.write_seconds = secs / batch.size();
+				if (g_StatsLog)
+				{
+					g_StatsLog->record(item.task.rel_path, item.res, item.ok || item.res.skipped);
+				}
+				st.files++;
+				st.bytes_in += item.res.in_size;
+				if (item.res.skipped)
+				{
+					st.skipped++;
+				}
+				else if (item.ok)
+				{
+					st.bytes_out += item.res.out_size;
+					st.copied += item.res.copied;
+					if (g_Manifest && item.hashed)
+					{
+						g_Manifest->record(item.task.rel_path, item.in_hash, item.res.out_hash, get_output_path(item.task.out_dir, item.task.in_path));
+					}
+				}
+				else
+				{
+					ReportFailure(item.task.rel_path, item.res);
+					st.failed++;
+				}
+			}
+		}
+	});
+
+	auto enqueue = [&tasks](DecTask&& _task) { tasks.push(std::move(_task)); };
+	WalkDirectory(_InputDir, _OutputDir, std::string(), _OutputDir, enqueue);
+	tasks.close();
+
+	reader.join();
+	for (size_t i = 0; i < decoders.size(); ++i)
+	{
+		decoders[i].join();
+	}
+	writer.join();
+	double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_begin).count();
+	std::cout.flush();
+	size_t failed = PrintWorkerStats(stats, wall);
+	printf("pipeline : read %.3f s (%s), write %.3f s (%s)\n",
+		read_seconds, ring_read ? "io_uring" : "blocking",
+		write_seconds, g_Pack ? "pack" : (ring_write ? "io_uring" : "blocking"));
+	return failed;
+}
+
+// Returns the number of files that failed.
+size_t DecDirectory(bcdec_ctx* ctx, const char* _InputDir, const char* _OutputDir, unsigned _Jobs = 1)
+{
+	if (!g_Pack)
+	{
+		mkd(_OutputDir);
+	}
+
+	if (g_Options.pipeline)
+	{
+		return DecDirectoryPipelined(_InputDir, _OutputDir, _Jobs);
+	}
+
+	if (_Jobs <= 1)
+	{
+		size_t failed = 0;
+		auto decode_now = [ctx, &failed](DecTask&& _task)
+		{
+			DecResult res;
+			failed += !DecFile(ctx, _task, &res);
+		};
+		WalkDirectory(_InputDir, _OutputDir, std::string(), _OutputDir, decode_now);
+		return failed;
+	}
+
+	DecTaskQueue queue(_Jobs * 64);
+	std::vector<DecStats> stats(_Jobs);
+	std::vector<std::thread> workers;
+	auto wall_begin = std::chrono::steady_clock::now();
+	for (unsigned w = 0; w < _Jobs; ++w)
+	{
+		workers.emplace_back([&, w]()
+		{
+			bcdec_ctx* wctx = bcdec_new();
+			DecStats& st = stats[w];
+			auto begin = std::chrono::steady_clock::now();
+			DecTask task;
+			while (queue.pop(task))
+			{
+				DecResult res;
+				st.files++;
+				st.bytes_in += get_file_size(task.in_path);
+				if (DecFile(wctx, task, &res))
+				{
+					st.bytes_out += res.out_size;
+					st.skipped += res.skipped;
+					st.copied += res.copied;
+				}
+				else
+				{
+					st.failed++;
+				}
+			}
+			st.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+			bcdec_free(wctx);
+		});
+	}
+
+	auto enqueue = [&queue](DecTask&& _task) { queue.push(std::move(_task)); };
+	WalkDirectory(_InputDir, _OutputDir, std::string(), _OutputDir, enqueue);
+	queue.close();
+
+	for (size_t i = 0; i < workers.size(); ++i)
+	{
+		workers[i].join();
+	}
+	double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_begin).count();
+	std::cout.flush();
+	UNUSED(ctx);
+	return PrintWorkerStats(stats, wall);
+}
+
+
+static const size_t STREAM_CHUNK = 64 * 1024;
+static const size_t STREAM_MAX_DUMP = 64 * 1024 * 1024;
+
+// Returns false while the ULEB128 at p is incomplete.
+static bool scan_uleb128(const uint8_t*& p, const uint8_t* pe, uint32_t& v, bool& bad)
+{
+	v = 0;
+	for (int sh = 0; p < pe; sh += 7)
+	{
+		uint8_t b = *p++;
+		v |= (uint32_t)(b & 0x7f) << sh;
+		if (b < 0x80)
+		{
+			return true;
+		}
+		if (sh >= 28)
+		{
+			bad = true;
+			return false;
+		}
+	}
+	return false;
+}
+
+// Size of the dump at the start of a stream buffer, 0 if it is still incomplete.
+static size_t scan_dump(const char* _Data, size_t _Size, bool& _Bad)
+{
+	const uint8_t* p = (const uint8_t*)_Data;
+	const uint8_t* pe = p + _Size;
+	uint32_t flags, len;
+	_Bad = false;
+	if (_Size < 4)
+	{
+		return 0;
+	}
+	if (p[0] != BCDUMP_HEAD1 || p[1] != BCDUMP_HEAD2 || p[2] != BCDUMP_HEAD3)
+	{
+		_Bad = true;
+		return 0;
+	}
+	p += 4;
+	if (!scan_uleb128(p, pe, flags, _Bad))
+	{
+		return 0;
+	}
+	if (!(flags & BCDUMP_F_STRIP))
+	{
+		if (!scan_uleb128(p, pe, len, _Bad) || (size_t)(pe - p) < len)
+		{
+			return 0;
+		}
+		p += len;
+	}
+	for (;;)
+	{
+		if (!scan_uleb128(p, pe, len, _Bad))
+		{
+			return 0;
+		}
+		if (len == 0)
+		{
+			return (size_t)(p - (const uint8_t*)_Data);
+		}
+		if ((size_t)(pe - p) < len)
+		{
+			return 0;
+		}
+		p += len;
+	}
+}
+
+static int sink_stdout(void* ud, const void* p, size_t n)
+{
+	return fwrite(p, 1, n, (FILE*)ud) == n ? 0 : 1;
+}
+
+// Decodes concatenated dumps from stdin to stdout. The buffer holds one chunk plus at most one dump.
+static bool DecStream(bcdec_ctx* ctx)
+{
+#ifdef _WIN32
+	_setmode(_fileno(stdin), _O_BINARY);
+	_setmode(_fileno(stdout), _O_BINARY);
+#endif
+	std::vector<char> buf(STREAM_CHUNK);
+	size_t begin = 0, end = 0;
+	unsigned count = 0;
+	bool eof = false;
+	for (;;)
+	{
+		bool bad;
+		size_t dumpsz = scan_dump(buf.data() + begin, end - begin, bad);
+		if (bad)
+		{
+			std::cerr << "Stream is not a bytecode dump at dump " << count << "." << std::endl;
+			return false;
+		}
+		if (dumpsz)
+		{
+			bcdec_sink sink = {};
+			sink.write = sink_stdout;
+			sink.ud = stdout;
+			if (bcdec_decode(ctx, buf.data() + begin, dumpsz, &sink, &g_Options.dec) != BCDEC_OK)
+			{
+				std::cerr << "Decoding failed at dump " << count << ": " << bcdec_errmsg(ctx) << std::endl;
+				return false;
+			}
+			begin += dumpsz;
+			++count;
+			continue;
+		}
+		if (eof)
+		{
+			break;
+		}
+		if (begin)
+		{
+			memmove(buf.data(), buf.data() + begin, end - begin);
+			end -= begin;
+			begin = 0;
+		}
+		if (buf.size() - end < STREAM_CHUNK)
+		{
+			if (buf.size() >= STREAM_MAX_DUMP)
+			{
+				std::cerr << "Dump " << count << " exceeds the stream buffer limit." << std::endl;
+				return false;
+			}
+			buf.resize(std::min(buf.size() * 2, STREAM_MAX_DUMP));
+		}
+		size_t n = fread(buf.data() + end, 1, buf.size() - end, stdin);
+		end += n;
+		eof = n == 0 && (feof(stdin) || ferror(stdin));
+	}
+	if (begin != end)
+	{
+		std::cerr << "Truncated dump at the end of the stream." << std::endl;
+		return false;
+	}
+	return fflush(stdout) == 0;
+}
+
+// Prints the prototype index of a dump, for picking a --proto number.
+static bool ListPrototypes(const char* _BCFilePath)
+{
+	std::vector<char> buf;
+	if (!ReadWholeFile(_BCFilePath, buf))
+	{
+		std::cerr << _BCFilePath << ": cannot read input" << std::endl;
+		return false;
+	}
+	auto begin = std::chrono::steady_clock::now();
+	std::vector<bcdec_proto> protos(64);
+	size_t count = bcdec_index(buf.data(), buf.size(), protos.data(), protos.size());
+	if (count > protos.size())
+	{
+		protos.resize(count);
+		bcdec_index(buf.data(), buf.size(), protos.data(), protos.size());
+	}
+	double secs = seconds_since(begin);
+	if (count == 0)
+	{
+		std::cerr << _BCFilePath << ": not a bytecode dump" << std::endl;
+		return false;
+	}
+	printf("proto  first  children  params  frame  uv      bc     kgc      kn     offset       size  flags\n");
+	for (size_t i = 0; i < count; ++i)
+	{
+		const bcdec_proto& p = protos[i];
+		printf("%5u  %5u  %8u  %6u  %5u  %2u  %6u  %6u  %6u  %9llu  %9llu  0x%02x%s\n",
+			(unsigned)i, (unsigned)p.first, p.children, p.numparams, p.framesize, p.sizeuv,
+			p.sizebc, p.sizekgc, p.sizekn, (unsigned long long)p.offset, (unsigned long long)p.size,
+			p.flags, i + 1 == count ? "  main" : "");
+	}
+	printf("%u prototypes indexed in %.3f ms\n", (unsigned)count, secs * 1e3);
+	return true;
+}
+
+// Decodes one prototype and its children into OutputDir/<stem>.<N>.lj.
+static bool DecPrototype(bcdec_ctx* ctx, const char* _BCFilePath, const std::string& _OutputDir, size_t _Index)
+{
+	std::vector<char> buf;
+	if (!ReadWholeFile(_BCFilePath, buf))
+	{
+		std::cerr << _BCFilePath << ": cannot read input" << std::endl;
+		return false;
+	}
+	std::vector<char> out;
+	bcdec_sink sink = {};
+	sink.write = sink_append;
+	sink.ud = &out;
+	if (bcdec_decode_proto(ctx, buf.data(), buf.size(), _Index, &sink) != BCDEC_OK)
+	{
+		std::cerr << _BCFilePath << ": " << bcdec_errmsg(ctx) << std::endl;
+		return false;
+	}
+	mkd(_OutputDir);
+	std::string out_path = append_path(_OutputDir, get_filename_stem(get_filename_from_path(_BCFilePath))) +
+		"." + std::to_string(_Index) + ".lj";
+	if (!WriteOutput(out_path.c_str(), std::string(), out.data(), out.size(), nullptr))
+	{
+		std::cerr << out_path << ": cannot write output" << std::endl;
+		return false;
+	}
+	std::cout << out_path << std::endl;
+	return true;
+}
+
+// Collects the files under a directory, or the file itself.
+static void CollectFiles(const std::string& _Path, std::vector<std::string>& _Files)
+{
+	if (stat_path(_Path) != EPathType::Directory)
+	{
+		_Files.push_back(_Path);
+		return;
+	}
+	ForEachDirEntry(_Path, [&](const std::string& _name, bool _is_dir)
+	{
+		if (_name == "." || _name == "..")
+		{
+			return;
+		}
+		if (_is_dir)
+		{
+			CollectFiles(append_path(_Path, _name), _Files);
+		}
+		else
+		{
+			_Files.push_back(append_path(_Path, _name));
+		}
+	});
+}
+
+// Runs _fn(worker, file index) over all files on _Jobs threads.
+template<typename Fn>
+static void ForEachFileParallel(size_t _Count, unsigned _Jobs, Fn _fn)
+{
+	std::atomic<size_t> next(0);
+	std::vector<std::thread> workers;
+	for (unsigned w = 0; w < _Jobs; ++w)
+	{
+		workers.emplace_back([&, w]()
+		{
+			for (size_t i; (i = next++) < _Count; )
+			{
+				_fn(w, i);
+			}
+		});
+	}
+	for (size_t i = 0; i < workers.size(); ++i)
+	{
+		workers[i].join();
+	}
+}
+
+// Recovers the opcode map of a client from a corpus of its dumps, checks
+// that every dump round trips with it and writes the resulting profile.
+static bool RecoverOpmap(const char* _Input, const std::string& _ProfilePath, unsigned _Jobs)
+{
+	std::vector<std::string> files;
+	CollectFiles(_Input, files);
+	std::vector<bcdec_opstats*> stats(_Jobs);
+	std::vector<char> scanned(files.size());
+	auto begin = std::chrono::steady_clock::now();
+	for (unsigned w = 0; w < _Jobs; ++w)
+	{
+		stats[w] = bcdec_opstats_new();
+	}
+	ForEachFileParallel(files.size(), _Jobs, [&](unsigned _w, size_t _i)
+	{
+		std::vector<char> buf;
+		scanned[_i] = ReadWholeFile(files[_i].c_str(), buf) &&
+			bcdec_opstats_add(stats[_w], buf.data(), buf.size()) == BCDEC_OK;
+	});
+	for (unsigned w = 1; w < _Jobs; ++w)
+	{
+		bcdec_opstats_merge(stats[0], stats[w]);
+		bcdec_opstats_free(stats[w]);
+	}
+	bcdec_opreport rep;
+	std::vector<char> detail(16384);
+	int r = bcdec_recover_opmap(stats[0], &rep, detail.data(), detail.size());
+	bcdec_opstats_free(stats[0]);
+	printf("%u of %u files scanned, %u prototypes, %llu instructions in %.2f s\n", rep.files, (unsigned)files.size(),
+		rep.protos, (unsigned long long)rep.ins, seconds_since(begin));
+	if (rep.files == 0)
+	{
+		std::cerr << "No input parses in the layout of the active profile." << std::endl;
+		return false;
+	}
+	if (r != BCDEC_OK)
+	{
+		std::cerr << "No opcode map fits the corpus. Check the other settings of the profile." << std::endl;
+		return false;
+	}
+	printf("%u dump opcodes in use, %u pinned by operand shapes and neighbours, %u entries changed\n",
+		rep.seen, rep.pinned, rep.changed);
+	if (detail[0])
+	{
+		printf("Told apart by frequency only:\n%s", detail.data());
+	}
+
+	std::atomic<unsigned> passed(0), failed(0);
+	begin = std::chrono::steady_clock::now();
+	std::vector<bcdec_ctx*> ctxs(_Jobs);
+	for (unsigned w = 0; w < _Jobs; ++w)
+	{
+		ctxs[w] = bcdec_new();
+	}
+	ForEachFileParallel(files.size(), _Jobs, [&](unsigned _w, size_t _i)
+	{
+		std::vector<char> buf;
+		if (!scanned[_i])
+		{
+			return;
+		}
+		if (ReadWholeFile(files[_i].c_str(), buf) && bcdec_check_roundtrip(ctxs[_w], buf.data(), buf.size()) == BCDEC_OK)
+		{
+			passed++;
+			return;
+		}
+		failed++;
+		std::lock_guard<std::mutex> lock(g_PrintMutex);
+		std::cerr << files[_i] << ": " << bcdec_errmsg(ctxs[_w]) << std::endl;
+	});
+	for (unsigned w = 0; w < _Jobs; ++w)
+	{
+		bcdec_free(ctxs[w]);
+	}
+	printf("%u of %u files round trip through lj_bcwrite and lj_bcread in %.2f s\n", passed.load(), rep.files, seconds_since(begin));
+
+	std::vector<char> text(bcdec_profile_text(nullptr, 0) + 1);
+	bcdec_profile_text(text.data(), text.size());
+	std::ofstream out(_ProfilePath, std::ios::binary);
+	if (!(out << text.data()) || !out.flush())
+	{
+		std::cerr << "Cannot write profile " << _ProfilePath << std::endl;
+		return false;
+	}
+	printf("Profile written to %s\n", _ProfilePath.c_str());
+	return failed == 0;
+}
+
+// Parses a whole argument as a decimal count of at least _Min. Unlike atoi,
+// garbage or a following flag is an error instead of 0.
+static bool ParseCount(const char* _Arg, unsigned long _Min, unsigned long _Max, unsigned long& _Value)
+{
+	if (_Arg == nullptr || *_Arg < '0' || *_Arg > '9')
+	{
+		return false;
+	}
+	char* end;
+	errno = 0;
+	unsigned long v = strtoul(_Arg, &end, 10);
+	if (errno != 0 || *end != '\0' || v < _Min || v > _Max)
+	{
+		return false;
+	}
+	_Value = v;
+	return true;
+}
+
+static void PrintUsage()
+{
+	std::cerr << R"(Usage: bcDec [-j N] [-a] [-u] [-t] [-i] [-r] [-s N] [-b N] [-p PackFile] [--stats StatsFile] [--strings Report] [--pool PoolFile] [--cache CacheDir] [--profile ProfileFile] [--verify] "InputFilePath/InputDir" ["OutputDir"])" << std::endl;
+	std::cerr << R"(       bcDec [-t] [-r] [-s N] [-b N] [--verify] - < dumps > decoded)" << std::endl;
+	std::cerr << R"(       bcDec --list InputFilePath)" << std::endl;
+	std::cerr << R"(       bcDec [--profile ProfileFile] --print-profile)" << std::endl;
+	std::cerr << R"(       bcDec [-j N] [--profile ProfileFile] --recover-opmap OutProfile "InputFilePath/InputDir")" << std::endl;
+	std::cerr << R"(       bcDec --proto N InputFilePath ["OutputDir"])" << std::endl;
+}
+
+// Takes the value of an option that needs one. A missing value, or another
+// option in its place, is a usage error.
+static bool ParseValue(const std::string& _Option, const char* _Arg, std::string& _Value)
+{
+	if (_Arg == nullptr || (_Arg[0] == '-' && _Arg[1] != '\0'))
+	{
+		std::cerr << "missing value for " << _Option << std::endl;
+		PrintUsage();
+		return false;
+	}
+	_Value = _Arg;
+	return true;
+}
+
+int main(int _argc, char **_argv)
+{
+	unsigned jobs = 1;
+	bool print_profile = false;
+	std::vector<const char*> args;
+	for (int i = 1; i < _argc; ++i)
+	{
+		std::string arg = _argv[i];
+		if (arg.compare(0, 2, "-j") == 0)
+		{
+			const char* num = arg.length() > 2 ? _argv[i] + 2 : (i + 1 < _argc ? _argv[++i] : nullptr);
+			unsigned long n;
+			if (!ParseCount(num, 1, UINT_MAX, n))
+			{
+				std::cerr << "-j takes a positive number of threads." << std::endl;
+				PrintUsage();
+				return 1;
+			}
+			jobs = (unsigned)n;
+		}
+		else if (arg == "-a")
+		{
+			g_Options.pipeline = true;
+		}
+		else if (arg == "-u")
+		{
+			g_Options.pipeline = true;
+			g_Options.io_uring = true;
+		}
+		else if (arg == "-t")
+		{
+			g_Options.dec.transcode = 1;
+		}
+		else if (arg == "-i")
+		{
+			g_Options.incremental = true;
+		}
+		else if (arg == "-r")
+		{
+			g_Options.dec.reset = 1;
+		}
+		else if (arg == "-s")
+		{
+			unsigned long n;
+			if (!ParseCount(i + 1 < _argc ? _argv[++i] : nullptr, 1, UINT_MAX, n))
+			{
+				std::cerr << "-s takes a positive number of string table slots." << std::endl;
+				PrintUsage();
+				return 1;
+			}
+			g_Options.dec.str_hint = (unsigned)n;
+			g_Options.dec.reset = 1;
+		}
+		else if (arg == "-b")
+		{
+			unsigned long n;
+			if (!ParseCount(i + 1 < _argc ? _argv[++i] : nullptr, 1, UINT_MAX, n))
+			{
+				std::cerr << "-b takes a positive number of buffer bytes." << std::endl;
+				PrintUsage();
+				return 1;
+			}
+			g_Options.dec.buf_hint = (unsigned)n;
+			g_Options.dec.reset = 1;
+		}
+		else if (arg == "-p")
+		{
+			if (!ParseValue(arg, i + 1 < _argc ? _argv[++i] : nullptr, g_Options.pack_path))
+			{
+				return 1;
+			}
+		}
+		else if (arg == "--strings")
+		{
+			if (!ParseValue(arg, i + 1 < _argc ? _argv[++i] : nullptr, g_Options.strings_path))
+			{
+				return 1;
+			}
+		}
+		else if (arg == "--pool")
+		{
+			if (!ParseValue(arg, i + 1 < _argc ? _argv[++i] : nullptr, g_Options.pool_path))
+			{
+				return 1;
+			}
+		}
+		else if (arg == "--list")
+		{
+			g_Options.list = true;
+		}
+		else if (arg == "--proto")
+		{
+			unsigned long n;
+			if (!ParseCount(i + 1 < _argc ? _argv[++i] : nullptr, 0, LONG_MAX, n))
+			{
+				std::cerr << "--proto takes a prototype number from --list." << std::endl;
+				PrintUsage();
+				return 1;
+			}
+			g_Options.proto = (long)n;
+		}
+		else if (arg == "--profile")
+		{
+			if (!ParseValue(arg, i + 1 < _argc ? _argv[++i] : nullptr, g_Options.profile_path))
+			{
+				return 1;
+			}
+		}
+		else if (arg == "--print-profile")
+		{
+			print_profile = true;
+		}
+		else if (arg == "--recover-opmap")
+		{
+			if (!ParseValue(arg, i + 1 < _argc ? _argv[++i] : nullptr, g_Options.recover_path))
+			{
+				return 1;
+			}
+		}
+		else if (arg == "--verify")
+		{
+			g_Options.dec.verify = 1;
+		}
+		else if (arg == "--cache")
+		{
+			if (!ParseValue(arg, i + 1 < _argc ? _argv[++i] : nullptr, g_Options.cache_path))
+			{
+				return 1;
+			}
+		}
+		else if (arg == "--stats")
+		{
+			if (!ParseValue(arg, i + 1 < _argc ? _argv[++i] : nullptr, g_Options.stats_path))
+			{
+				return 1;
+			}
+			g_Options.dec.stats = 1;
+		}
+		else
+		{
+			args.push_back(_argv[i]);
+		}
+	}
+
+	if (!g_Options.profile_path.empty())
+	{
+		std::vector<char> text;
+		char err[256];
+		if (!ReadWholeFile(g_Options.profile_path.c_str(), text))
+		{
+			std::cerr << "Cannot read profile " << g_Options.profile_path << std::endl;
+			return 1;
+		}
+		if (bcdec_load_profile(text.data(), text.size(), err, sizeof(err)) != BCDEC_OK)
+		{
+			std::cerr << g_Options.profile_path << ": " << err << std::endl;
+			return 1;
+		}
+	}
+	if (print_profile)
+	{
+		std::vector<char> text(bcdec_profile_text(nullptr, 0) + 1);
+		bcdec_profile_text(text.data(), text.size());
+		std::cout << text.data();
+		return 0;
+	}
+
+	if (args.size() < 1 || args.size() > 2)
+	{
+		PrintUsage();
+		return 1;
+	}
+	if (!g_Options.recover_path.empty())
+	{
+		if (args.size() != 1 || stat_path(args[0]) == EPathType::Invalid)
+		{
+			std::cerr << "--recover-opmap takes one input file or directory." << std::endl;
+			return 1;
+		}
+		return RecoverOpmap(args[0], g_Options.recover_path, jobs) ? 0 : 1;
+	}
+	if (g_Options.incremental && !g_Options.pack_path.empty())
+	{
+		std::cerr << "-i cannot be combined with -p." << std::endl;
+		return 1;
+	}
+	if (g_Options.dec.verify && g_Options.dec.transcode)
+	{
+		std::cerr << "--verify checks loaded prototypes and cannot be combined with -t." << std::endl;
+		return 1;
+	}
+	bool analyze = !g_Options.strings_path.empty() || !g_Options.pool_path.empty();
+	if (g_Options.incremental && analyze)
+	{
+		std::cerr << "--strings and --pool need every file and cannot be combined with -i." << std::endl;
+		return 1;
+	}
+
+	if (strcmp(args[0], "-") == 0)
+	{
+		if (args.size() == 2 || g_Options.incremental || !g_Options.pack_path.empty() || g_Options.dec.stats || analyze || !g_Options.cache_path.empty() ||
+			g_Options.list || g_Options.proto >= 0)
+		{
+			std::cerr << "Stream mode writes to stdout and cannot be combined with -i, -p, --stats, --strings, --pool, --cache, --list or --proto." << std::endl;
+			return 1;
+		}
+		// Dumps come one at a time, so -j splits each large one.
+		g_Options.dec.threads = jobs;
+		bcdec_ctx* sctx = bcdec_new();
+		bool ok = DecStream(sctx);
+		bcdec_free(sctx);
+		return ok ? 0 : 1;
+	}
+
+	auto st = stat_path(args[0]);
+	if (st == EPathType::Invalid)
+	{
+		std::cerr << "Invalid input path." << std::endl;
+		return 1;
+	}
+	if (g_Options.list || g_Options.proto >= 0)
+	{
+		if (st != EPathType::Regular)
+		{
+			std::cerr << "--list and --proto take a single file." << std::endl;
+			return 1;
+		}
+		if (g_Options.list)
+		{
+			return ListPrototypes(args[0]) ? 0 : 1;
+		}
+		bcdec_ctx* pctx = bcdec_new();
+		bool ok = DecPrototype(pctx, args[0], args.size() == 2 ? args[1] : append_path(get_parent_path(args[0]), "dec"), (size_t)g_Options.proto);
+		bcdec_free(pctx);
+		return ok ? 0 : 1;
+	}
+
+	BCPackWriter pack;
+	if (!g_Options.pack_path.empty())
+	{
+		mkd(get_parent_path(g_Options.pack_path));
+		if (!pack.open(g_Options.pack_path))
+		{
+			std::cerr << "Cannot create pack file." << std::endl;
+			return 1;
+		}
+		g_Pack = &pack;
+	}
+
+	std::string outdir;
+	if (st == EPathType::Directory)
+	{
+		outdir = args.size() == 2 ? args[1] : append_path(args[0], "dec");
+	}
+	else
+	{
+		outdir = args.size() == 2 ? args[1] : append_path(get_parent_path(args[0]), "dec");
+	}
+
+	DecManifest manifest;
+	std::string manifest_path = remove_unnecessary_slashes(outdir) + ".manifest";
+	if (g_Options.incremental)
+	{
+		manifest.load(manifest_path, get_decoder_version());
+		g_Manifest = &manifest;
+	}
+
+	DecStatsLog stats_log;
+	if (g_Options.dec.stats)
+	{
+		if (!stats_log.open(g_Options.stats_path))
+		{
+			std::cerr << "Cannot create stats file." << std::endl;
+			return 1;
+		}
+		g_StatsLog = &stats_log;
+	}
+
+	BCStringPool string_pool;
+	if (analyze)
+	{
+		g_StringPool = &string_pool;
+	}
+
+	BCDecCache cache;
+	if (!g_Options.cache_path.empty())
+	{
+		mkd(get_parent_path(g_Options.cache_path));
+		if (!cache.open(g_Options.cache_path, get_decoder_version()))
+		{
+			std::cerr << "Cannot open cache directory." << std::endl;
+			return 1;
+		}
+		g_Cache = &cache;
+	}
+
+	bcdec_ctx* ctx = bcdec_new();
+	bool ok;
+	if (st == EPathType::Directory)
+	{
+		ok = DecDirectory(ctx, args[0], outdir.c_str(), jobs) == 0;
+	}
+	else
+	{
+		g_Options.dec.threads = jobs;
+		ok = DecSingle(ctx, args[0], outdir.c_str());
+	}
+	bcdec_free(ctx);
+
+	if (g_Manifest)
+	{
+		if (st == EPathType::Directory)
+		{
+			manifest.remove_vanished(outdir);
+		}
+		if (!manifest.save(manifest_path, get_decoder_version()))
+		{
+			std::cerr << "Cannot write manifest." << std::endl;
+			ok = false;
+		}
+		manifest.print_summary();
+	}
+
+	if (g_Cache)
+	{
+		std::cout.flush();
+		g_Cache->print_summary();
+	}
+	if (g_Pack && !g_Pack->finish())
+	{
+		std::cerr << "Cannot write pack file." << std::endl;
+		ok = false;
+	}
+	if (g_StatsLog)
+	{
+		std::cout.flush();
+		g_StatsLog->print_summary();
+	}
+	if (g_StringPool)
+	{
+		std::cout.flush();
+		g_StringPool->print_summary();
+		if (!g_Options.strings_path.empty() && !g_StringPool->write_report(g_Options.strings_path))
+		{
+			std::cerr << "Cannot write string report." << std::endl;
+			ok = false;
+		}
+		if (!g_Options.pool_path.empty() && !g_StringPool->write_pool(g_Options.pool_path))
+		{
+			std::cerr << "Cannot write string pool." << std::endl;
+			ok = false;
+		}
+	}
+	return ok ? 0 : 1;
+}
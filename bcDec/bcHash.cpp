@@ -0,0 +1,147 @@
+#include "bcHash.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <fstream>
+#include <vector>
+
+
+static const uint64_t P1 = 11400714785074694791ULL;
+static const uint64_t P2 = 14029467366897019727ULL;
+static const uint64_t P3 = 1609587929392839161ULL;
+static const uint64_t P4 = 9650029242287828579ULL;
+static const uint64_t P5 = 2870177450012600261ULL;
+
+static inline uint64_t rotl64(uint64_t _v, int _r)
+{
+	return (_v << _r) | (_v >> (64 - _r));
+}
+
+static inline uint64_t read64(const uint8_t* _p)
+{
+	uint64_t v = 0;
+	for (int i = 7; i >= 0; --i)
+	{
+		v = (v << 8) | _p[i];
+	}
+	return v;
+}
+
+static inline uint32_t read32(const uint8_t* _p)
+{
+	return (uint32_t)_p[0] | ((uint32_t)_p[1] << 8) | ((uint32_t)_p[2] << 16) | ((uint32_t)_p[3] << 24);
+}
+
+static inline uint64_t round64(uint64_t _acc, uint64_t _input)
+{
+	_acc += _input * P2;
+	_acc = rotl64(_acc, 31);
+	return _acc * P1;
+}
+
+static inline uint64_t merge64(uint64_t _acc, uint64_t _val)
+{
+	_acc ^= round64(0, _val);
+	return _acc * P1 + P4;
+}
+
+uint64_t bchash64(const void* _data, size_t _size, uint64_t _seed)
+{
+	const uint8_t* p = (const uint8_t*)_data;
+	const uint8_t* pe = p + _size;
+	uint64_t h;
+	if (_size >= 32)
+	{
+		uint64_t v1 = _seed + P1 + P2;
+		uint64_t v2 = _seed + P2;
+		uint64_t v3 = _seed;
+		uint64_t v4 = _seed - P1;
+		do
+		{
+			v1 = round64(v1, read64(p));
+			v2 = round64(v2, read64(p + 8));
+			v3 = round64(v3, read64(p + 16));
+			v4 = round64(v4, read64(p + 24));
+			p += 32;
+		} while (pe - p >= 32);
+		h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+		h = merge64(h, v1);
+		h = merge64(h, v2);
+		h = merge64(h, v3);
+		h = merge64(h, v4);
+	}
+	else
+	{
+		h = _seed + P5;
+	}
+	h += (uint64_t)_size;
+	for (; pe - p >= 8; p += 8)
+	{
+		h ^= round64(0, read64(p));
+		h = rotl64(h, 27) * P1 + P4;
+	}
+	if (pe - p >= 4)
+	{
+		h ^= (uint64_t)read32(p) * P1;
+		h = rotl64(h, 23) * P2 + P3;
+		p += 4;
+	}
+	for (; p < pe; ++p)
+	{
+		h ^= (*p) * P5;
+		h = rotl64(h, 11) * P1;
+	}
+	h ^= h >> 33;
+	h *= P2;
+	h ^= h >> 29;
+	h *= P3;
+	h ^= h >> 32;
+	return h;
+}
+
+bool bchash64_file(const std::string& _path, uint64_t* _hash)
+{
+	std::ifstream ifs(_path.c_str(), std::ios::binary);
+	if (!ifs)
+	{
+		return false;
+	}
+	ifs.seekg(0, std::ios::end);
+	std::vector<char> buf((size_t)ifs.tellg());
+	ifs.seekg(0);
+	ifs.read(buf.data(), (std::streamsize)buf.size());
+	if (!ifs && !buf.empty())
+	{
+		return false;
+	}
+	*_hash = bchash64(buf.data(), buf.size());
+	return true;
+}
+
+std::string bchash_hex(uint64_t _hash)
+{
+	char buf[17];
+	snprintf(buf, sizeof(buf), "%016llx", (unsigned long long)_hash);
+	return buf;
+}
+
+bool bchash_parse(const std::string& _hex, uint64_t* _hash)
+{
+	if (_hex.length() != 16)
+	{
+		return false;
+	}
+	uint64_t v = 0;
+	for (size_t i = 0; i < _hex.length(); ++i)
+	{
+		char c = _hex[i];
+		int d = c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+		if (d < 0)
+		{
+			return false;
+		}
+		v = (v << 4) | (uint64_t)d;
+	}
+	*_hash = v;
+	return true;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+// XXH64 of a memory block.
+uint64_t bchash64(const void* _data, size_t _size, uint64_t _seed = 0);
+
+// XXH64 of a file's contents. Returns false if the file cannot be read.
+bool bchash64_file(const std::string& _path, uint64_t* _hash);
+
+std::string bchash_hex(uint64_t _hash);
+bool bchash_parse(const std::string& _hex, uint64_t* _hash);
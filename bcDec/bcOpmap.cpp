@@ -0,0 +1,671 @@
+#include "bcCore.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <bitset>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lj_bcdump.h"
+
+// Opcode map recovery. Every instruction of the corpus is scanned with its
+// operands decoded through the active profile and its opcode left as
+// stored. Per dump opcode we keep which operand shapes held for every use
+// and which dump opcodes were seen next to it. A standard opcode stays a
+// candidate for a dump opcode only if its BCMode and the way the parser
+// emits it agree with all of that. The candidates left are matched by how
+// often each opcode occurs in compiled Lua.
+
+typedef std::bitset<BC__MAX> OpSet;
+
+// Operand shapes that can hold for an instruction.
+enum
+{
+	SH_A_SLOT,     // A < framesize.
+	SH_A_RBASE,    // A <= framesize.
+	SH_A_UV,       // A < sizeuv.
+	SH_B_SLOT,
+	SH_B_RBASE,
+	SH_C_SLOT,
+	SH_C_STR,      // C is a string constant.
+	SH_C_NUM,      // C < sizekn.
+	SH_D_SLOT,
+	SH_D_UV,
+	SH_D_PRI,      // D is nil, false or true.
+	SH_D_NUM,
+	SH_D_STR,
+	SH_D_TAB,
+	SH_D_FUNC,
+	SH_D_CDATA,
+	SH_D_JUMP,     // The jump target is an instruction of the function.
+	SH_KNIL,       // A <= D.
+	SH_CAT,        // B < C.
+	SH_D1,         // RET0.
+	SH_D2,         // RET1.
+	SH_D3,         // RET with two or more results.
+	SH_VARG,       // Vararg function and C == numparams.
+	SH_C3,         // Two iterator arguments.
+	SH_NOTLAST,    // Not the last instruction of its function.
+	SH_HASPRED,    // Not the first instruction after the header.
+	SH_NEXT_JUMP,  // Always followed by the same jump opcode. Set when solving.
+	SH__MAX
+};
+
+struct OpStats
+{
+	uint64_t count[BC__MAX];
+	uint32_t shapes[BC__MAX];  // SH_* bits that held for every use.
+	OpSet next[BC__MAX];
+	OpSet prev[BC__MAX];
+	OpSet target[BC__MAX];         // Opcodes at the jump target, if D is one.
+	OpSet before_target[BC__MAX];  // Opcodes right before the jump target.
+	bool bad;  // An opcode out of range: not a dump of this client.
+
+	OpStats() : bad(false)
+	{
+		memset(count, 0, sizeof(count));
+		memset(shapes, 0xff, sizeof(shapes));
+	}
+
+	void merge(const OpStats& _o)
+	{
+		for (int r = 0; r < BC__MAX; ++r)
+		{
+			count[r] += _o.count[r];
+			shapes[r] &= _o.shapes[r];
+			next[r] |= _o.next[r];
+			prev[r] |= _o.prev[r];
+			target[r] |= _o.target[r];
+			before_target[r] |= _o.before_target[r];
+		}
+	}
+};
+
+struct bcdec_opstats
+{
+	OpStats ops;
+	unsigned files = 0;
+	unsigned protos = 0;
+	size_t ins = 0;
+	std::vector<BCIns> bc;  // Scratch for lj_bcscan_mod().
+	std::vector<uint8_t> kgct;
+};
+
+// Standard opcodes that the parser never emits or lj_bcwrite() reverts.
+static bool op_in_dumps(int _op)
+{
+	switch (_op)
+	{
+	case BC_ISTYPE: case BC_ISNUM: case BC_TGETR: case BC_TSETR:
+	case BC_JFORI: case BC_IFORL: case BC_JFORL: case BC_IITERL: case BC_JITERL:
+	case BC_ILOOP: case BC_JLOOP:
+		return false;
+	default:
+		return _op < BC_FUNCF;
+	}
+}
+
+// SH_* bits an instruction needs to be the standard opcode.
+static uint32_t op_shapes(int _op)
+{
+#define BCSHAPE(name, ma, mb, mc, mt) { BCM##ma, BCM##mb, BCM##mc },
+	static const uint8_t modes[][3] = { BCDEF(BCSHAPE) };
+#undef BCSHAPE
+	uint32_t s = 0;
+	switch (modes[_op][0])
+	{
+	case BCMdst: case BCMbase: case BCMvar: s |= 1u << SH_A_SLOT; break;
+	case BCMrbase: s |= 1u << SH_A_RBASE; break;
+	case BCMuv: s |= 1u << SH_A_UV; break;
+	}
+	if (modes[_op][1] != BCMnone)
+	{
+		switch (modes[_op][1])
+		{
+		case BCMvar: s |= 1u << SH_B_SLOT; break;
+		case BCMrbase: s |= 1u << SH_B_RBASE; break;
+		}
+		switch (modes[_op][2])
+		{
+		case BCMvar: case BCMrbase: s |= 1u << SH_C_SLOT; break;
+		case BCMstr: s |= 1u << SH_C_STR; break;
+		case BCMnum: s |= 1u << SH_C_NUM; break;
+		}
+	}
+	else
+	{
+		switch (modes[_op][2])
+		{
+		case BCMdst: case BCMbase: case BCMvar: s |= 1u << SH_D_SLOT; break;
+		case BCMuv: s |= 1u << SH_D_UV; break;
+		case BCMpri: s |= 1u << SH_D_PRI; break;
+		case BCMnum: s |= 1u << SH_D_NUM; break;
+		case BCMstr: s |= 1u << SH_D_STR; break;
+		case BCMtab: s |= 1u << SH_D_TAB; break;
+		case BCMfunc: s |= 1u << SH_D_FUNC; break;
+		case BCMcdata: s |= 1u << SH_D_CDATA; break;
+		case BCMjump: s |= 1u << SH_D_JUMP; break;
+		}
+	}
+	switch (_op)
+	{
+	case BC_KNIL: s |= 1u << SH_KNIL; break;
+	case BC_CAT: s |= 1u << SH_CAT; break;
+	case BC_RET0: s |= 1u << SH_D1; break;
+	case BC_RET1: s |= 1u << SH_D2; break;
+	case BC_RET: s |= 1u << SH_D3; break;
+	case BC_VARG: s |= 1u << SH_VARG; break;
+	case BC_ITERC: case BC_ITERN: s |= 1u << SH_C3; break;
+	case BC_CALLM: case BC_CALLMT: case BC_RETM: case BC_TSETM: s |= 1u << SH_HASPRED; break;
+	}
+	// Every function ends with a return or a tail call.
+	if (!(_op == BC_RETM || _op == BC_RET || _op == BC_RET0 || _op == BC_RET1 || _op == BC_CALLMT || _op == BC_CALLT))
+	{
+		s |= 1u << SH_NOTLAST;
+	}
+	return s;
+}
+
+static void scan_proto(void* ud, const BCProtoRec* r, const BCIns* bc, const uint8_t* kgct)
+{
+	OpStats* st = (OpStats*)ud;
+	MSize nbc = r->sizebc - 1;
+	auto kgc_is = [&](MSize _idx, int _type)
+	{
+		if (_idx >= r->sizekgc)
+		{
+			return false;
+		}
+		int t = kgct[r->sizekgc - 1 - _idx];
+		return _type == BCDUMP_KGC_I64 ? (t >= BCDUMP_KGC_I64 && t <= BCDUMP_KGC_COMPLEX) : t == _type;
+	};
+	for (MSize i = 0; i < nbc; ++i)
+	{
+		if (bc_op(bc[i]) >= BC__MAX)
+		{
+			st->bad = true;
+			return;
+		}
+	}
+	for (MSize i = 0; i < nbc; ++i)
+	{
+		BCIns ins = bc[i];
+		unsigned op = bc_op(ins), a = bc_a(ins), b = bc_b(ins), c = bc_c(ins), d = bc_d(ins);
+		int32_t t = (int32_t)(i + 1 + d) - BCBIAS_J;
+		uint32_t s = 0;
+		s |= (uint32_t)(a < r->framesize) << SH_A_SLOT;
+		s |= (uint32_t)(a <= r->framesize) << SH_A_RBASE;
+		s |= (uint32_t)(a < r->sizeuv) << SH_A_UV;
+		s |= (uint32_t)(b < r->framesize) << SH_B_SLOT;
+		s |= (uint32_t)(b <= r->framesize) << SH_B_RBASE;
+		s |= (uint32_t)(c < r->framesize) << SH_C_SLOT;
+		s |= (uint32_t)kgc_is(c, BCDUMP_KGC_STR) << SH_C_STR;
+		s |= (uint32_t)(c < r->sizekn) << SH_C_NUM;
+		s |= (uint32_t)(d < r->framesize) << SH_D_SLOT;
+		s |= (uint32_t)(d < r->sizeuv) << SH_D_UV;
+		s |= (uint32_t)(d <= 2) << SH_D_PRI;
+		s |= (uint32_t)(d < r->sizekn) << SH_D_NUM;
+		s |= (uint32_t)kgc_is(d, BCDUMP_KGC_STR) << SH_D_STR;
+		s |= (uint32_t)kgc_is(d, BCDUMP_KGC_TAB) << SH_D_TAB;
+		s |= (uint32_t)kgc_is(d, BCDUMP_KGC_CHILD) << SH_D_FUNC;
+		s |= (uint32_t)kgc_is(d, BCDUMP_KGC_I64) << SH_D_CDATA;
+		s |= (uint32_t)(t >= 0 && t < (int32_t)nbc) << SH_D_JUMP;
+		s |= (uint32_t)(a <= d) << SH_KNIL;
+		s |= (uint32_t)(b < c) << SH_CAT;
+		s |= (uint32_t)(d == 1) << SH_D1;
+		s |= (uint32_t)(d == 2) << SH_D2;
+		s |= (uint32_t)(d >= 3) << SH_D3;
+		s |= (uint32_t)((r->flags & PROTO_VARARG) && c == r->numparams) << SH_VARG;
+		s |= (uint32_t)(c == 3) << SH_C3;
+		s |= (uint32_t)(i + 1 < nbc) << SH_NOTLAST;
+		s |= (uint32_t)(i > 0) << SH_HASPRED;
+		st->count[op]++;
+		st->shapes[op] &= s;
+		if (i > 0)
+		{
+			st->prev[op].set(bc_op(bc[i - 1]));
+		}
+		if (i + 1 < nbc)
+		{
+			st->next[op].set(bc_op(bc[i + 1]));
+		}
+		if (t >= 0 && t < (int32_t)nbc)
+		{
+			st->target[op].set(bc_op(bc[t]));
+			if (t > 0)
+			{
+				st->before_target[op].set(bc_op(bc[t - 1]));
+			}
+		}
+	}
+}
+
+bcdec_opstats* bcdec_opstats_new(void)
+{
+	return new bcdec_opstats();
+}
+
+void bcdec_opstats_free(bcdec_opstats* _st)
+{
+	delete _st;
+}
+
+int bcdec_opstats_add(bcdec_opstats* _st, const void* _in, size_t _n)
+{
+	OpStats file;
+	_st->bc.resize(_n / 4 + 1);
+	_st->kgct.resize(_n + 1);
+	MSize protos = lj_bcscan_mod((const char*)_in, _n, _st->bc.data(), _st->kgct.data(), scan_proto, &file);
+	if (!protos || file.bad)
+	{
+		return BCDEC_ERR_FORMAT;
+	}
+	_st->ops.merge(file);
+	_st->files++;
+	_st->protos += protos;
+	for (int r = 0; r < BC__MAX; ++r)
+	{
+		_st->ins += file.count[r];
+	}
+	return BCDEC_OK;
+}
+
+void bcdec_opstats_merge(bcdec_opstats* _dst, const bcdec_opstats* _src)
+{
+	_dst->ops.merge(_src->ops);
+	_dst->files += _src->files;
+	_dst->protos += _src->protos;
+	_dst->ins += _src->ins;
+}
+
+// Uses per 10000 instructions of compiled Lua, from a mix of library and
+// game code. Only the order within opcodes of the same shape matters.
+static double op_prior(int _op)
+{
+	switch (_op)
+	{
+	case BC_MOV: return 1100;
+	case BC_JMP: return 1000;
+	case BC_CALL: return 950;
+	case BC_UGET: return 900;
+	case BC_TGETS: return 800;
+	case BC_KSTR: return 650;
+	case BC_KSHORT: return 450;
+	case BC_GGET: return 450;
+	case BC_TSETS: return 300;
+	case BC_ISF: return 180;
+	case BC_ISNES: return 150;
+	case BC_FNEW: return 150;
+	case BC_RET0: return 150;
+	case BC_KPRI: return 150;
+	case BC_TGETV: return 150;
+	case BC_ADDVN: return 130;
+	case BC_TDUP: return 120;
+	case BC_IST: return 120;
+	case BC_TSETB: return 100;
+	case BC_CAT: return 100;
+	case BC_RET1: return 100;
+	case BC_ADDVV: return 90;
+	case BC_TSETV: return 90;
+	case BC_CALLM: return 70;
+	case BC_ISNEN: return 60;
+	case BC_TGETB: return 60;
+	case BC_TNEW: return 60;
+	case BC_LEN: return 50;
+	case BC_SUBVN: return 50;
+	case BC_CALLT: return 50;
+	case BC_ISGE: return 45;
+	case BC_USETV: return 40;
+	case BC_KNUM: return 40;
+	case BC_ISEQS: return 40;
+	case BC_ITERL: return 40;
+	case BC_ISEQN: return 35;
+	case BC_ISGT: return 30;
+	case BC_UCLO: return 30;
+	case BC_FORI: return 25;
+	case BC_FORL: return 25;
+	case BC_ITERC: return 25;
+	case BC_ISTC: return 20;
+	case BC_ISFC: return 15;
+	case BC_ISNEXT: return 15;
+	case BC_ITERN: return 15;
+	case BC_SUBVV: return 15;
+	case BC_RET: return 15;
+	case BC_MODVN: return 12;
+	case BC_ISNEV: return 12;
+	case BC_KNIL: return 12;
+	case BC_MULVN: return 12;
+	case BC_ADDNV: return 10;
+	case BC_ISEQV: return 10;
+	case BC_USETP: return 8;
+	case BC_USETN: return 8;
+	case BC_DIVVN: return 8;
+	case BC_UNM: return 6;
+	case BC_SUBNV: return 6;
+	case BC_LOOP: return 6;
+	case BC_VARG: return 5;
+	case BC_ISLT: return 5;
+	case BC_MULVV: return 4;
+	case BC_RETM: return 3;
+	case BC_MULNV: return 3;
+	case BC_ISEQP: return 3;
+	case BC_ISNEP: return 3;
+	case BC_USETS: return 3;
+	case BC_NOT: return 3;
+	case BC_CALLMT: return 2;
+	case BC_GSET: return 2;
+	case BC_DIVVV: return 2;
+	case BC_ISLE: return 2;
+	case BC_TSETM: return 1;
+	case BC_POW: return 1;
+	case BC_DIVNV: return 1;
+	case BC_MODVV: return 1;
+	case BC_KCDATA: return 1;
+	case BC_MODNV: return 0.5;
+	default: return 0;
+	}
+}
+
+// Which dump opcodes next to an instruction the parser constrains, and to
+// which standard opcodes.
+enum { REL_NEXT, REL_PREV, REL_TARGET, REL_BEFORE_TARGET };
+
+struct OpRule
+{
+	int op;
+	int rel;
+	OpSet allowed;
+};
+
+static std::vector<OpRule> op_rules()
+{
+	auto set = [](std::initializer_list<int> _ops)
+	{
+		OpSet s;
+		for (int op : _ops)
+		{
+			s.set(op);
+		}
+		return s;
+	};
+	std::vector<OpRule> rules;
+	// Comparisons and tests are always followed by the branch.
+	for (int op = BC_ISLT; op <= BC_ISF; ++op)
+	{
+		rules.push_back({ op, REL_NEXT, set({ BC_JMP }) });
+	}
+	rules.push_back({ BC_ITERC, REL_NEXT, set({ BC_ITERL }) });
+	rules.push_back({ BC_ITERN, REL_NEXT, set({ BC_ITERL }) });
+	rules.push_back({ BC_ITERL, REL_PREV, set({ BC_ITERC, BC_ITERN }) });
+	rules.push_back({ BC_ITERL, REL_BEFORE_TARGET, set({ BC_JMP, BC_ISNEXT }) });
+	rules.push_back({ BC_ISNEXT, REL_TARGET, set({ BC_ITERN }) });
+	rules.push_back({ BC_FORI, REL_BEFORE_TARGET, set({ BC_FORL }) });
+	rules.push_back({ BC_FORL, REL_BEFORE_TARGET, set({ BC_FORI }) });
+	// MULTRES comes from the instruction right before.
+	for (int op : { BC_CALLM, BC_CALLMT, BC_RETM, BC_TSETM })
+	{
+		rules.push_back({ op, REL_PREV, set({ BC_CALL, BC_CALLM, BC_VARG }) });
+	}
+	return rules;
+}
+
+// Narrows the candidates of each dump opcode until the shapes, the
+// neighbour rules and the opcodes already pinned elsewhere agree.
+static void narrow(const OpStats& _st, OpSet* _cand)
+{
+	std::vector<OpRule> rules = op_rules();
+	for (int r = 0; r < BC__MAX; ++r)
+	{
+		for (int op = 0; op < BC__MAX; ++op)
+		{
+			uint32_t need = op_shapes(op);
+			bool ok = _st.count[r] ? op_in_dumps(op) && (need & _st.shapes[r]) == need : true;
+			_cand[r].set(op, ok);
+		}
+	}
+	for (bool changed = true; changed; )
+	{
+		changed = false;
+		for (const OpRule& rule : rules)
+		{
+			for (int r = 0; r < BC__MAX; ++r)
+			{
+				if (!_cand[r].test(rule.op))
+				{
+					continue;
+				}
+				const OpSet& near = rule.rel == REL_NEXT ? _st.next[r] : rule.rel == REL_PREV ? _st.prev[r] :
+					rule.rel == REL_TARGET ? _st.target[r] : _st.before_target[r];
+				for (int s = 0; s < BC__MAX; ++s)
+				{
+					if (near.test(s) && (_cand[s] & rule.allowed).none())
+					{
+						_cand[r].reset(rule.op);
+						changed = true;
+						break;
+					}
+				}
+			}
+		}
+		for (int r = 0; r < BC__MAX; ++r)
+		{
+			if (_cand[r].count() != 1)
+			{
+				continue;
+			}
+			for (int s = 0; s < BC__MAX; ++s)
+			{
+				if (s != r && (_cand[s] & _cand[r]).any())
+				{
+					_cand[s] &= ~_cand[r];
+					changed = true;
+				}
+			}
+		}
+	}
+}
+
+// Minimum cost perfect matching of rows to columns (Hungarian method).
+// Returns the column of each row.
+static std::vector<int> assign(const std::vector<double>& _cost, int _n)
+{
+	const double INF = 1e18;
+	std::vector<double> u(_n + 1), v(_n + 1), minv(_n + 1);
+	std::vector<int> p(_n + 1), way(_n + 1);
+	std::vector<bool> used(_n + 1);
+	for (int i = 1; i <= _n; ++i)
+	{
+		p[0] = i;
+		int j0 = 0;
+		std::fill(minv.begin(), minv.end(), INF);
+		std::fill(used.begin(), used.end(), false);
+		do
+		{
+			used[j0] = true;
+			int i0 = p[j0], j1 = 0;
+			double delta = INF;
+			for (int j = 1; j <= _n; ++j)
+			{
+				if (used[j])
+				{
+					continue;
+				}
+				double cur = _cost[(i0 - 1) * _n + j - 1] - u[i0] - v[j];
+				if (cur < minv[j])
+				{
+					minv[j] = cur;
+					way[j] = j0;
+				}
+				if (minv[j] < delta)
+				{
+					delta = minv[j];
+					j1 = j;
+				}
+			}
+			for (int j = 0; j <= _n; ++j)
+			{
+				if (used[j])
+				{
+					u[p[j]] += delta;
+					v[j] -= delta;
+				}
+				else
+				{
+					minv[j] -= delta;
+				}
+			}
+			j0 = j1;
+		} while (p[j0] != 0);
+		do
+		{
+			int j1 = way[j0];
+			p[j0] = p[j1];
+			j0 = j1;
+		} while (j0);
+	}
+	std::vector<int> col(_n);
+	for (int j = 1; j <= _n; ++j)
+	{
+		col[p[j] - 1] = j - 1;
+	}
+	return col;
+}
+
+// Shapes that rarely hold by chance, and how much an opcode that holds
+// one is worth being paired with a standard opcode that needs it.
+static double shape_weight(int _sh)
+{
+	switch (_sh)
+	{
+	case SH_D_JUMP: return 8;
+	case SH_D_FUNC: case SH_D_TAB: case SH_D_CDATA: case SH_NEXT_JUMP: return 4;
+	case SH_D_STR: case SH_C_STR: return 3;
+	case SH_D_UV: case SH_A_UV: case SH_D1: case SH_D2: case SH_D3: case SH_VARG: case SH_C3: return 2;
+	case SH_D_PRI: return 1;
+	case SH_KNIL: case SH_CAT: return 0.5;
+	default: return 0;
+	}
+}
+
+// SH_* bits that the standard opcode accounts for when they hold.
+static uint32_t op_explains(int _op)
+{
+	uint32_t s = op_shapes(_op);
+	if (s & (1u << SH_A_SLOT))
+	{
+		s |= 1u << SH_A_RBASE;
+	}
+	if (s & (1u << SH_B_SLOT))
+	{
+		s |= 1u << SH_B_RBASE;
+	}
+	if (s & ((1u << SH_D1) | (1u << SH_D2)))
+	{
+		s |= 1u << SH_D_PRI;
+	}
+	if ((_op >= BC_ISLT && _op <= BC_ISF) || _op == BC_ITERC || _op == BC_ITERN)
+	{
+		s |= 1u << SH_NEXT_JUMP;
+	}
+	return s;
+}
+
+#define BCNAME(name, ma, mb, mc, mt) #name,
+static const char* const bc_names[] = { BCDEF(BCNAME) };
+#undef BCNAME
+
+int bcdec_recover_opmap(const bcdec_opstats* _st, bcdec_opreport* _rep, char* _detail, size_t _cap)
+{
+	const OpStats& st = _st->ops;
+	OpSet cand[BC__MAX];
+	narrow(st, cand);
+
+	BCObfProfile pf;
+	lj_bcgetprofile_mod(&pf);
+	// Cost of a pairing: how far the opcode's share of the corpus is from
+	// its share in compiled Lua, on a log scale, plus the weight of every
+	// telling shape the standard opcode leaves unexplained. Shapes count in
+	// full once an opcode has a few dozen uses. Ties keep the map of the active
+	// profile.
+	const double BLOCKED = 1e9;
+	double total = _st->ins ? (double)_st->ins : 1.0;
+	std::vector<double> cost(BC__MAX * BC__MAX);
+	for (int r = 0; r < BC__MAX; ++r)
+	{
+		double share = log((st.count[r] + 0.5) / total);
+		uint32_t held = st.count[r] ? st.shapes[r] & ~(1u << SH_NEXT_JUMP) : 0;
+		for (int nx = 0; nx < BC__MAX && st.next[r].count() == 1; ++nx)
+		{
+			if (st.next[r].test(nx) && st.count[nx] && (st.shapes[nx] & (1u << SH_D_JUMP)))
+			{
+				held |= 1u << SH_NEXT_JUMP;
+			}
+		}
+		double sure = st.count[r] < 32 ? st.count[r] / 32.0 : 1.0;
+		for (int op = 0; op < BC__MAX; ++op)
+		{
+			double c = fabs(share - log(op_prior(op) / 10000.0 + 1e-7));
+			uint32_t odd = held & ~op_explains(op);
+			for (int sh = 0; odd; ++sh, odd >>= 1)
+			{
+				c += (odd & 1) ? shape_weight(sh) * sure : 0;
+			}
+			cost[r * BC__MAX + op] = cand[r].test(op) ? c - (pf.opmap[r] == op ? 1e-3 : 0) : BLOCKED;
+		}
+	}
+	std::vector<int> col = assign(cost, BC__MAX);
+
+	bcdec_opreport rep = {};
+	rep.files = _st->files;
+	rep.protos = _st->protos;
+	rep.ins = _st->ins;
+	std::ostringstream detail;
+	bool consistent = true;
+	for (int r = 0; r < BC__MAX; ++r)
+	{
+		int op = col[r];
+		if (cost[r * BC__MAX + op] >= BLOCKED)
+		{
+			consistent = false;
+		}
+		rep.changed += pf.opmap[r] != op;
+		pf.opmap[r] = (uint8_t)op;
+		if (!st.count[r])
+		{
+			continue;
+		}
+		rep.seen++;
+		if (cand[r].count() == 1)
+		{
+			rep.pinned++;
+			continue;
+		}
+		detail << r << ' ' << bc_names[op] << ' ' << st.count[r] << " uses, could also be";
+		for (int o = 0; o < BC__MAX; ++o)
+		{
+			if (o != op && cand[r].test(o))
+			{
+				detail << ' ' << bc_names[o];
+			}
+		}
+		detail << '\n';
+	}
+	if (_rep)
+	{
+		*_rep = rep;
+	}
+	std::string text = detail.str();
+	if (_detail && _cap)
+	{
+		size_t n = text.size() < _cap - 1 ? text.size() : _cap - 1;
+		memcpy(_detail, text.data(), n);
+		_detail[n] = 0;
+	}
+	if (!_st->files || !consistent || !lj_bcprofile_mod(&pf))
+	{
+		return BCDEC_ERR_FORMAT;
+	}
+	return BCDEC_OK;
+}
@@ -0,0 +1,275 @@
+#include "bcPack.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+#include "lua.h"
+#include "lauxlib.h"
+
+
+static const char BCPACK_MAGIC[8] = { 'B', 'C', 'D', 'P', 'A', 'C', 'K', '1' };
+static const size_t BCPACK_TRAILER_SIZE = 8 + 4 + 4 + sizeof(BCPACK_MAGIC);
+
+struct CRC32Table
+{
+	uint32_t v[256];
+
+	CRC32Table()
+	{
+		for (uint32_t i = 0; i < 256; ++i)
+		{
+			uint32_t c = i;
+			for (int k = 0; k < 8; ++k)
+			{
+				c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+			}
+			v[i] = c;
+		}
+	}
+};
+
+uint32_t bcpack_crc32(const void* _data, size_t _size, uint32_t _crc)
+{
+	static const CRC32Table table;
+	const uint8_t* p = (const uint8_t*)_data;
+	uint32_t c = ~_crc;
+	for (size_t i = 0; i < _size; ++i)
+	{
+		c = table.v[(c ^ p[i]) & 0xff] ^ (c >> 8);
+	}
+	return ~c;
+}
+
+static void put_u32(std::string& _out, uint32_t _v)
+{
+	for (int i = 0; i < 4; ++i)
+	{
+		_out.push_back((char)(_v >> (i * 8)));
+	}
+}
+
+static void put_u64(std::string& _out, uint64_t _v)
+{
+	for (int i = 0; i < 8; ++i)
+	{
+		_out.push_back((char)(_v >> (i * 8)));
+	}
+}
+
+static uint32_t get_u32(const char* _p)
+{
+	const uint8_t* p = (const uint8_t*)_p;
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t get_u64(const char* _p)
+{
+	return (uint64_t)get_u32(_p) | ((uint64_t)get_u32(_p + 4) << 32);
+}
+
+static bool entry_less(const BCPackEntry& _lhs, const BCPackEntry& _rhs)
+{
+	return _lhs.name < _rhs.name;
+}
+
+
+bool BCPackWriter::open(const std::string& _path)
+{
+	path = _path;
+	tmp_path = _path + ".tmp";
+	entries.clear();
+	ofs.open(tmp_path.c_str(), std::ios::binary | std::ios::trunc);
+	ofs.write(BCPACK_MAGIC, sizeof(BCPACK_MAGIC));
+	offset = sizeof(BCPACK_MAGIC);
+	return ofs.good();
+}
+
+bool BCPackWriter::append(const std::string& _name, const char* _data, size_t _size)
+{
+	uint32_t crc = bcpack_crc32(_data, _size);
+	std::lock_guard<std::mutex> lock(mtx);
+	ofs.write(_data, (std::streamsize)_size);
+	if (!ofs.good())
+	{
+		return false;
+	}
+	BCPackEntry entry;
+	entry.name = _name;
+	entry.offset = offset;
+	entry.size = _size;
+	entry.crc = crc;
+	entries.push_back(entry);
+	offset += _size;
+	return true;
+}
+
+bool BCPackWriter::finish()
+{
+	// A name that was appended twice keeps its last chunk, like a loose
+	// output file that gets overwritten.
+	std::stable_sort(entries.begin(), entries.end(), entry_less);
+	std::vector<BCPackEntry> unique;
+	for (size_t i = 0; i < entries.size(); ++i)
+	{
+		if (!unique.empty() && unique.back().name == entries[i].name)
+		{
+			unique.back() = entries[i];
+		}
+		else
+		{
+			unique.push_back(entries[i]);
+		}
+	}
+	entries.swap(unique);
+	std::string index;
+	for (size_t i = 0; i < entries.size(); ++i)
+	{
+		const BCPackEntry& e = entries[i];
+		put_u32(index, (uint32_t)e.name.size());
+		index += e.name;
+		put_u64(index, e.offset);
+		put_u64(index, e.size);
+		put_u32(index, e.crc);
+	}
+	std::string trailer;
+	put_u64(trailer, offset);
+	put_u32(trailer, (uint32_t)entries.size());
+	put_u32(trailer, bcpack_crc32(index.data(), index.size()));
+	trailer.append(BCPACK_MAGIC, sizeof(BCPACK_MAGIC));
+	ofs.write(index.data(), (std::streamsize)index.size());
+	ofs.write(trailer.data(), (std::streamsize)trailer.size());
+	ofs.close();
+	if (ofs.fail())
+	{
+		::remove(tmp_path.c_str());
+		return false;
+	}
+	::remove(path.c_str());
+	return ::rename(tmp_path.c_str(), path.c_str()) == 0;
+}
+
+
+bool BCPackReader::open(const std::string& _path)
+{
+	close();
+	ifs.open(_path.c_str(), std::ios::binary);
+	if (!ifs)
+	{
+		return false;
+	}
+	char head[sizeof(BCPACK_MAGIC)];
+	char trailer[BCPACK_TRAILER_SIZE];
+	ifs.seekg(0, std::ios::end);
+	uint64_t file_size = (uint64_t)ifs.tellg();
+	if (file_size < sizeof(head) + sizeof(trailer))
+	{
+		close();
+		return false;
+	}
+	ifs.seekg(0);
+	ifs.read(head, sizeof(head));
+	ifs.seekg((std::streamoff)(file_size - sizeof(trailer)));
+	ifs.read(trailer, sizeof(trailer));
+	uint64_t index_offset = get_u64(trailer);
+	uint32_t count = get_u32(trailer + 8);
+	uint32_t index_crc = get_u32(trailer + 12);
+	if (!ifs || memcmp(head, BCPACK_MAGIC, sizeof(head)) != 0 ||
+		memcmp(trailer + 16, BCPACK_MAGIC, sizeof(BCPACK_MAGIC)) != 0 ||
+		index_offset < sizeof(head) || index_offset > file_size - sizeof(trailer))
+	{
+		close();
+		return false;
+	}
+
+	std::vector<char> index((size_t)(file_size - sizeof(trailer) - index_offset));
+	ifs.seekg((std::streamoff)index_offset);
+	ifs.read(index.data(), (std::streamsize)index.size());
+	if (!ifs || bcpack_crc32(index.data(), index.size()) != index_crc)
+	{
+		close();
+		return false;
+	}
+	const char* p = index.data();
+	const char* pe = p + index.size();
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		BCPackEntry e;
+		if (pe - p < 4)
+		{
+			break;
+		}
+		uint32_t name_len = get_u32(p);
+		p += 4;
+		if ((uint64_t)(pe - p) < (uint64_t)name_len + 20)
+		{
+			break;
+		}
+		e.name.assign(p, name_len);
+		p += name_len;
+		e.offset = get_u64(p);
+		e.size = get_u64(p + 8);
+		e.crc = get_u32(p + 16);
+		p += 20;
+		if (e.offset > index_offset || e.size > index_offset - e.offset)
+		{
+			break;
+		}
+		entries.push_back(e);
+	}
+	if (entries.size() != count || p != pe)
+	{
+		close();
+		return false;
+	}
+	return true;
+}
+
+void BCPackReader::close()
+{
+	if (ifs.is_open())
+	{
+		ifs.close();
+	}
+	ifs.clear();
+	entries.clear();
+}
+
+const BCPackEntry* BCPackReader::find(const std::string& _name) const
+{
+	BCPackEntry key;
+	key.name = _name;
+	std::vector<BCPackEntry>::const_iterator it = std::lower_bound(entries.begin(), entries.end(), key, entry_less);
+	if (it == entries.end() || it->name != _name)
+	{
+		return nullptr;
+	}
+	return &*it;
+}
+
+bool BCPackReader::read(const BCPackEntry& _entry, std::vector<char>& _out)
+{
+	_out.resize((size_t)_entry.size);
+	ifs.clear();
+	ifs.seekg((std::streamoff)_entry.offset);
+	ifs.read(_out.data(), (std::streamsize)_out.size());
+	return ifs.good() && bcpack_crc32(_out.data(), _out.size()) == _entry.crc;
+}
+
+int BCPackReader::load(lua_State* L, const std::string& _name)
+{
+	const BCPackEntry* e = find(_name);
+	std::vector<char> buf;
+	if (!e)
+	{
+		lua_pushfstring(L, "module '%s' not found in pack", _name.c_str());
+		return LUA_ERRFILE;
+	}
+	if (!read(*e, buf))
+	{
+		lua_pushfstring(L, "module '%s' is damaged in pack", _name.c_str());
+		return LUA_ERRFILE;
+	}
+	std::string chunkname = "=" + _name;
+	return luaL_loadbuffer(L, buf.data(), buf.size(), chunkname.c_str());
+}
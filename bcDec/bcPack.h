@@ -0,0 +1,67 @@
+#pragma once
+
+#include <stdint.h>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+struct lua_State;
+
+// Pack file layout, all integers little endian:
+//   "BCDPACK1"
+//   chunk data, back to back
+//   index entries: u32 name_len, name, u64 offset, u64 size, u32 crc32
+//   trailer:       u64 index_offset, u32 entry_count, u32 index_crc32, "BCDPACK1"
+// Index entries are sorted by name. Names use '/' as separator.
+
+struct BCPackEntry
+{
+	std::string name;
+	uint64_t offset = 0;
+	uint64_t size = 0;
+	uint32_t crc = 0;
+};
+
+uint32_t bcpack_crc32(const void* _data, size_t _size, uint32_t _crc = 0);
+
+class BCPackWriter
+{
+public:
+	BCPackWriter() : offset(0) {}
+
+	bool open(const std::string& _path);
+	bool append(const std::string& _name, const char* _data, size_t _size);
+	bool finish();
+
+private:
+	BCPackWriter(const BCPackWriter&);
+	BCPackWriter& operator=(const BCPackWriter&);
+
+	std::string path;
+	std::string tmp_path;
+	std::ofstream ofs;
+	std::mutex mtx;
+	std::vector<BCPackEntry> entries;
+	uint64_t offset;
+};
+
+class BCPackReader
+{
+public:
+	bool open(const std::string& _path);
+	void close();
+
+	const std::vector<BCPackEntry>& list() const { return entries; }
+	const BCPackEntry* find(const std::string& _name) const;
+	bool read(const BCPackEntry& _entry, std::vector<char>& _out);
+
+	// Loads a module like luaL_loadbuffer, with chunk name "=name".
+	// Returns LUA_ERRFILE with a message on the stack if the module is
+	// missing or its checksum does not match.
+	int load(lua_State* L, const std::string& _name);
+
+private:
+	std::ifstream ifs;
+	std::vector<BCPackEntry> entries;
+};
@@ -0,0 +1,258 @@
+#include "bcCore.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sstream>
+#include <string>
+
+#include "lj_bcdump.h"
+
+// Profile text, one setting per line, '#' starts a comment. Settings that
+// are left out keep their built-in value.
+//
+//   opmap   OP0 OP1 ...          standard opcode of each dump opcode, by name or number
+//   header  F0 F1 F2 F3          framesize, flags, numparams and sizeuv in stored order
+//   chain   on|off               header bytes XORed with the previous field
+//   sizes   kn kgc|kgc kn        order of numknU and numkgcU
+//   consts  knum kgc|kgc knum    order of the number and GC constants
+//   ktab    hash array|array hash
+//   ins     a|b|c KEY IDX        operand = byte ^ KEY ^ (index & IDX)
+//   string  KEY IDX              byte = byte ^ KEY ^ (offset & IDX)
+//   kgc     child N tab N i64 N u64 N complex N str N
+
+#define BCNAME(name, ma, mb, mc, mt) #name,
+static const char* const bc_names[] = { BCDEF(BCNAME) };
+#undef BCNAME
+
+static const char* const hdr_names[] = { "framesize", "flags", "numparams", "sizeuv" };
+static const char* const kgc_names[] = { "child", "tab", "i64", "u64", "complex" };
+
+// Captured before the first profile is installed.
+static const BCObfProfile& builtin_profile()
+{
+	static BCObfProfile pf;
+	static bool init = false;
+	if (!init)
+	{
+		lj_bcgetprofile_mod(&pf);
+		init = true;
+	}
+	return pf;
+}
+
+static int find_name(const char* const* _names, int _count, const std::string& _name)
+{
+	for (int i = 0; i < _count; ++i)
+	{
+		if (_name == _names[i])
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+static bool parse_byte(const std::string& _tok, unsigned _max, unsigned* _out)
+{
+	char* end;
+	unsigned long v = strtoul(_tok.c_str(), &end, 0);
+	if (_tok.empty() || *end || v > _max)
+	{
+		return false;
+	}
+	*_out = (unsigned)v;
+	return true;
+}
+
+static bool parse_line(std::istringstream& _in, const std::string& _key, BCObfProfile* _pf, std::string* _err)
+{
+	std::string a, b;
+	unsigned v, w;
+	if (_key == "opmap")
+	{
+		for (int i = 0; i < BC__MAX; ++i)
+		{
+			if (!(_in >> a))
+			{
+				*_err = "opmap needs " + std::to_string(BC__MAX) + " opcodes";
+				return false;
+			}
+			int op = find_name(bc_names, BC__MAX, a);
+			if (op < 0 && !parse_byte(a, BC__MAX - 1, &v))
+			{
+				*_err = "unknown opcode " + a;
+				return false;
+			}
+			_pf->opmap[i] = (uint8_t)(op >= 0 ? (unsigned)op : v);
+		}
+	}
+	else if (_key == "header")
+	{
+		for (int i = 0; i < 4; ++i)
+		{
+			int f = (_in >> a) ? find_name(hdr_names, 4, a) : -1;
+			if (f < 0)
+			{
+				*_err = "header needs framesize, flags, numparams and sizeuv";
+				return false;
+			}
+			_pf->hdr[i] = (uint8_t)f;
+		}
+	}
+	else if (_key == "chain")
+	{
+		_in >> a;
+		if (a != "on" && a != "off")
+		{
+			*_err = "chain is on or off";
+			return false;
+		}
+		_pf->hdrchain = a == "on";
+	}
+	else if (_key == "sizes" || _key == "consts")
+	{
+		const char* kn = _key == "sizes" ? "kn" : "knum";
+		_in >> a >> b;
+		if (!((a == kn && b == "kgc") || (a == "kgc" && b == kn)))
+		{
+			*_err = _key + " is " + kn + " kgc or kgc " + kn;
+			return false;
+		}
+		(_key == "sizes" ? _pf->knsizefirst : _pf->knfirst) = a == kn;
+	}
+	else if (_key == "ktab")
+	{
+		_in >> a >> b;
+		if (!((a == "hash" && b == "array") || (a == "array" && b == "hash")))
+		{
+			*_err = "ktab is hash array or array hash";
+			return false;
+		}
+		_pf->hashfirst = a == "hash";
+	}
+	else if (_key == "ins")
+	{
+		_in >> a;
+		int op = a == "a" ? 0 : a == "b" ? 1 : a == "c" ? 2 : -1;
+		if (op < 0 || !(_in >> a >> b) || !parse_byte(a, 255, &v) || !parse_byte(b, 255, &w))
+		{
+			*_err = "ins is a|b|c KEY IDX";
+			return false;
+		}
+		_pf->inskey[op] = (uint8_t)v;
+		_pf->insidx[op] = (uint8_t)w;
+	}
+	else if (_key == "string")
+	{
+		if (!(_in >> a >> b) || !parse_byte(a, 255, &v) || !parse_byte(b, 255, &w))
+		{
+			*_err = "string is KEY IDX";
+			return false;
+		}
+		_pf->strkey = (uint8_t)v;
+		_pf->stridx = (uint8_t)w;
+	}
+	else if (_key == "kgc")
+	{
+		while (_in >> a)
+		{
+			int t = find_name(kgc_names, BCDUMP_KGC_STR, a);
+			if ((t < 0 && a != "str") || !(_in >> b) || !parse_byte(b, 255, &v))
+			{
+				*_err = "kgc is a list of child|tab|i64|u64|complex|str N";
+				return false;
+			}
+			(t < 0 ? _pf->kgcstr : _pf->kgc[t]) = (uint8_t)v;
+		}
+	}
+	else
+	{
+		*_err = "unknown setting " + _key;
+		return false;
+	}
+	if (_in >> a)
+	{
+		*_err = "extra value " + a;
+		return false;
+	}
+	return true;
+}
+
+int bcdec_load_profile(const char* _text, size_t _n, char* _err, size_t _errlen)
+{
+	const BCObfProfile& builtin = builtin_profile();
+	std::string err;
+	if (!_text)
+	{
+		lj_bcprofile_mod(nullptr);
+		return BCDEC_OK;
+	}
+	BCObfProfile pf = builtin;
+	std::istringstream text(std::string(_text, _n));
+	std::string line;
+	for (int lineno = 1; err.empty() && std::getline(text, line); ++lineno)
+	{
+		line = line.substr(0, line.find('#'));
+		std::istringstream in(line);
+		std::string key;
+		if ((in >> key) && !parse_line(in, key, &pf, &err))
+		{
+			err = "line " + std::to_string(lineno) + ": " + err;
+		}
+	}
+	if (err.empty() && !lj_bcprofile_mod(&pf))
+	{
+		err = "opmap, header and kgc codes must not repeat, and kgc codes must be below str";
+	}
+	if (!err.empty())
+	{
+		if (_err && _errlen)
+		{
+			snprintf(_err, _errlen, "%s", err.c_str());
+		}
+		return BCDEC_ERR_FORMAT;
+	}
+	return BCDEC_OK;
+}
+
+size_t bcdec_profile_text(char* _buf, size_t _cap)
+{
+	BCObfProfile pf;
+	builtin_profile();
+	lj_bcgetprofile_mod(&pf);
+	std::ostringstream out;
+	out << "opmap";
+	for (int i = 0; i < BC__MAX; ++i)
+	{
+		out << ' ' << bc_names[pf.opmap[i]];
+	}
+	out << "\nheader";
+	for (int i = 0; i < 4; ++i)
+	{
+		out << ' ' << hdr_names[pf.hdr[i]];
+	}
+	out << "\nchain " << (pf.hdrchain ? "on" : "off");
+	out << "\nsizes " << (pf.knsizefirst ? "kn kgc" : "kgc kn");
+	out << "\nconsts " << (pf.knfirst ? "knum kgc" : "kgc knum");
+	out << "\nktab " << (pf.hashfirst ? "hash array" : "array hash");
+	for (int i = 0; i < 3; ++i)
+	{
+		out << "\nins " << "abc"[i] << ' ' << (unsigned)pf.inskey[i] << ' ' << (unsigned)pf.insidx[i];
+	}
+	out << "\nstring " << (unsigned)pf.strkey << ' ' << (unsigned)pf.stridx;
+	out << "\nkgc";
+	for (int i = 0; i < BCDUMP_KGC_STR; ++i)
+	{
+		out << ' ' << kgc_names[i] << ' ' << (unsigned)pf.kgc[i];
+	}
+	out << " str " << (unsigned)pf.kgcstr << '\n';
+	std::string s = out.str();
+	if (_buf && _cap)
+	{
+		size_t n = s.size() < _cap - 1 ? s.size() : _cap - 1;
+		memcpy(_buf, s.data(), n);
+		_buf[n] = 0;
+	}
+	return s.size();
+}
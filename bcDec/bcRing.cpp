@@ -0,0 +1,310 @@
+#include "bcRing.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+#ifdef BCDEC_HAVE_IO_URING
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <linux/io_uring.h>
+#endif
+
+
+static const uint32_t RING_MAX_IO = 1u << 30;
+
+static void read_blocking(BCFileIO* _files, size_t _count)
+{
+	for (size_t i = 0; i < _count; ++i)
+	{
+		std::ifstream ifs(_files[i].path, std::ios::binary);
+		_files[i].data.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+		_files[i].ok = ifs.is_open() && !ifs.bad();
+	}
+}
+
+static void write_blocking(BCFileIO* _files, size_t _count)
+{
+	for (size_t i = 0; i < _count; ++i)
+	{
+		remove(_files[i].path.c_str());
+		std::ofstream ofs(_files[i].path, std::ios::binary | std::ios::trunc);
+		ofs.write(_files[i].data.data(), (std::streamsize)_files[i].data.size());
+		ofs.close();
+		_files[i].ok = !ofs.fail();
+	}
+}
+
+BCRing::BCRing()
+	: fd(-1), entries(0), to_submit(0), sq_ptr(nullptr), cq_ptr(nullptr), sq_size(0), cq_size(0),
+	sqes(nullptr), sqes_size(0), sq_head(nullptr), sq_tail(nullptr), sq_mask(nullptr), sq_array(nullptr),
+	cq_head(nullptr), cq_tail(nullptr), cq_mask(nullptr), cqes(nullptr)
+{
+}
+
+BCRing::~BCRing()
+{
+#ifdef BCDEC_HAVE_IO_URING
+	if (sqes)
+	{
+		munmap(sqes, sqes_size);
+	}
+	if (cq_ptr && cq_ptr != sq_ptr)
+	{
+		munmap(cq_ptr, cq_size);
+	}
+	if (sq_ptr)
+	{
+		munmap(sq_ptr, sq_size);
+	}
+	if (fd >= 0)
+	{
+		::close(fd);
+	}
+#endif
+}
+
+#ifdef BCDEC_HAVE_IO_URING
+
+bool BCRing::init(unsigned _entries)
+{
+	struct io_uring_params p;
+	memset(&p, 0, sizeof(p));
+	int rfd = (int)syscall(__NR_io_uring_setup, _entries, &p);
+	if (rfd < 0)
+	{
+		return false;
+	}
+	sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+	cq_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	if (p.features & IORING_FEAT_SINGLE_MMAP)
+	{
+		sq_size = cq_size = std::max(sq_size, cq_size);
+	}
+	sq_ptr = mmap(nullptr, sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, rfd, IORING_OFF_SQ_RING);
+	if (sq_ptr == MAP_FAILED)
+	{
+		sq_ptr = nullptr;
+		::close(rfd);
+		return false;
+	}
+	cq_ptr = sq_ptr;
+	if (!(p.features & IORING_FEAT_SINGLE_MMAP))
+	{
+		cq_ptr = mmap(nullptr, cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, rfd, IORING_OFF_CQ_RING);
+		if (cq_ptr == MAP_FAILED)
+		{
+			cq_ptr = nullptr;
+			::close(rfd);
+			return false;
+		}
+	}
+	sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+	sqes = mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, rfd, IORING_OFF_SQES);
+	if (sqes == MAP_FAILED)
+	{
+		sqes = nullptr;
+		::close(rfd);
+		return false;
+	}
+	char* sq = (char*)sq_ptr;
+	char* cq = (char*)cq_ptr;
+	sq_head = (unsigned*)(sq + p.sq_off.head);
+	sq_tail = (unsigned*)(sq + p.sq_off.tail);
+	sq_mask = (unsigned*)(sq + p.sq_off.ring_mask);
+	sq_array = (unsigned*)(sq + p.sq_off.array);
+	cq_head = (unsigned*)(cq + p.cq_off.head);
+	cq_tail = (unsigned*)(cq + p.cq_off.tail);
+	cq_mask = (unsigned*)(cq + p.cq_off.ring_mask);
+	cqes = cq + p.cq_off.cqes;
+	entries = p.sq_entries;
+	fd = rfd;
+	return true;
+}
+
+bool BCRing::prep(uint8_t _op, int _fd, void* _buf, uint32_t _len, uint64_t _off, uint64_t _user)
+{
+	unsigned tail = *sq_tail;
+	if (tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE) >= entries)
+	{
+		return false;
+	}
+	unsigned idx = tail & *sq_mask;
+	struct io_uring_sqe* sqe = (struct io_uring_sqe*)sqes + idx;
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->opcode = _op;
+	sqe->fd = _fd;
+	sqe->addr = (uint64_t)(uintptr_t)_buf;
+	sqe->len = _len;
+	sqe->off = _off;
+	sqe->user_data = _user;
+	sq_array[idx] = idx;
+	__atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+	to_submit++;
+	return true;
+}
+
+// Submits queued requests and waits for one completion.
+bool BCRing::wait(uint64_t& _user, int& _res)
+{
+	for (;;)
+	{
+		unsigned head = *cq_head;
+		if (head != __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE))
+		{
+			struct io_uring_cqe* cqe = (struct io_uring_cqe*)cqes + (head & *cq_mask);
+			_user = cqe->user_data;
+			_res = cqe->res;
+			__atomic_store_n(cq_head, head + 1, __ATOMIC_RELEASE);
+			return true;
+		}
+		int r = (int)syscall(__NR_io_uring_enter, fd, to_submit, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+		if (r < 0 && errno != EINTR)
+		{
+			return false;
+		}
+		if (r > 0)
+		{
+			to_submit -= std::min((unsigned)r, to_submit);
+		}
+	}
+}
+
+// Moves each file's data through the ring until it is complete or fails.
+void BCRing::run(BCFileIO* _files, size_t _count, const std::vector<int>& _fds, bool _write)
+{
+	uint8_t op = _write ? IORING_OP_WRITE : IORING_OP_READ;
+	std::vector<size_t> done(_count, 0);
+	std::vector<size_t> queue;
+	size_t inflight = 0;
+	for (size_t i = 0; i < _count; ++i)
+	{
+		if (_fds[i] >= 0 && !_files[i].data.empty())
+		{
+			queue.push_back(i);
+		}
+	}
+	while (!queue.empty() || inflight)
+	{
+		while (!queue.empty())
+		{
+			size_t i = queue.back();
+			size_t left = _files[i].data.size() - done[i];
+			uint32_t len = (uint32_t)std::min(left, (size_t)RING_MAX_IO);
+			if (!prep(op, _fds[i], _files[i].data.data() + done[i], len, done[i], i))
+			{
+				break;
+			}
+			queue.pop_back();
+			inflight++;
+		}
+		uint64_t user;
+		int res;
+		if (!wait(user, res))
+		{
+			// The ring is unusable. Fail whatever is still in flight.
+			for (size_t i = 0; i < _count; ++i)
+			{
+				if (done[i] != _files[i].data.size())
+				{
+					_files[i].ok = false;
+				}
+			}
+			return;
+		}
+		inflight--;
+		BCFileIO& f = _files[user];
+		if (res < 0)
+		{
+			f.ok = false;
+			continue;
+		}
+		if (res == 0)
+		{
+			// The file shrank since it was sized, or the device is full.
+			f.ok = !_write;
+			f.data.resize(done[user]);
+			continue;
+		}
+		done[user] += (size_t)res;
+		if (done[user] < f.data.size())
+		{
+			queue.push_back((size_t)user);
+		}
+	}
+}
+
+void BCRing::read_files(BCFileIO* _files, size_t _count)
+{
+	if (!active())
+	{
+		read_blocking(_files, _count);
+		return;
+	}
+	std::vector<int> fds(_count, -1);
+	for (size_t i = 0; i < _count; ++i)
+	{
+		struct stat st;
+		fds[i] = ::open(_files[i].path.c_str(), O_RDONLY);
+		_files[i].ok = fds[i] >= 0 && fstat(fds[i], &st) == 0;
+		_files[i].data.resize(_files[i].ok ? (size_t)st.st_size : 0);
+	}
+	run(_files, _count, fds, false);
+	for (size_t i = 0; i < _count; ++i)
+	{
+		if (fds[i] >= 0)
+		{
+			::close(fds[i]);
+		}
+	}
+}
+
+void BCRing::write_files(BCFileIO* _files, size_t _count)
+{
+	if (!active())
+	{
+		write_blocking(_files, _count);
+		return;
+	}
+	std::vector<int> fds(_count, -1);
+	for (size_t i = 0; i < _count; ++i)
+	{
+		::unlink(_files[i].path.c_str());
+		fds[i] = ::open(_files[i].path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		_files[i].ok = fds[i] >= 0;
+	}
+	run(_files, _count, fds, true);
+	for (size_t i = 0; i < _count; ++i)
+	{
+		if (fds[i] >= 0 && ::close(fds[i]) != 0)
+		{
+			_files[i].ok = false;
+		}
+	}
+}
+
+#else
+
+bool BCRing::init(unsigned _entries)
+{
+	(void)_entries;
+	return false;
+}
+
+void BCRing::read_files(BCFileIO* _files, size_t _count)
+{
+	read_blocking(_files, _count);
+}
+
+void BCRing::write_files(BCFileIO* _files, size_t _count)
+{
+	write_blocking(_files, _count);
+}
+
+#endif
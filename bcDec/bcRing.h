@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// One whole-file read or write in a batch.
+struct BCFileIO
+{
+	std::string path;
+	std::vector<char> data;
+	bool ok = false;
+};
+
+// Batched whole-file I/O for the pipeline stages. Uses io_uring when the
+// build has BCDEC_HAVE_IO_URING and the kernel accepts the ring, and plain
+// blocking calls otherwise. One instance per thread.
+class BCRing
+{
+public:
+	BCRing();
+	~BCRing();
+
+	// Returns false if io_uring cannot be used. The blocking path still works.
+	bool init(unsigned _entries);
+	bool active() const { return fd >= 0; }
+
+	// Reads each file completely into data.
+	void read_files(BCFileIO* _files, size_t _count);
+	// Replaces each file with data. The old file is unlinked first, so
+	// other links to it are left alone.
+	void write_files(BCFileIO* _files, size_t _count);
+
+private:
+	BCRing(const BCRing&);
+	BCRing& operator=(const BCRing&);
+
+	bool prep(uint8_t _op, int _fd, void* _buf, uint32_t _len, uint64_t _off, uint64_t _user);
+	bool wait(uint64_t& _user, int& _res);
+	void run(BCFileIO* _files, size_t _count, const std::vector<int>& _fds, bool _write);
+
+	int fd;
+	unsigned entries;
+	unsigned to_submit;
+	void* sq_ptr;
+	void* cq_ptr;
+	size_t sq_size;
+	size_t cq_size;
+	void* sqes;
+	size_t sqes_size;
+	unsigned* sq_head;
+	unsigned* sq_tail;
+	unsigned* sq_mask;
+	unsigned* sq_array;
+	unsigned* cq_head;
+	unsigned* cq_tail;
+	unsigned* cq_mask;
+	void* cqes;
+};
@@ -0,0 +1,201 @@
+#include "bcStrPool.h"
+
+#include <stdio.h>
+#include <algorithm>
+#include <fstream>
+
+#include "bcCore.h"
+
+
+static const char BCSTRPOOL_MAGIC[8] = { 'B', 'C', 'D', 'S', 'T', 'R', 'P', '1' };
+
+static void put_u32(std::ofstream& _ofs, uint32_t _v)
+{
+	char b[4];
+	for (int i = 0; i < 4; ++i)
+	{
+		b[i] = (char)(_v >> (i * 8));
+	}
+	_ofs.write(b, 4);
+}
+
+// Printable form for the report: escapes quotes, backslashes and control bytes.
+static std::string escape_string(const std::string& _s)
+{
+	std::string out = "\"";
+	for (size_t i = 0; i < _s.length(); ++i)
+	{
+		unsigned char c = (unsigned char)_s[i];
+		if (c == '"' || c == '\\')
+		{
+			out += '\\';
+			out += (char)c;
+		}
+		else if (c < 0x20 || c == 0x7f)
+		{
+			char esc[8];
+			snprintf(esc, sizeof(esc), "\\x%02x", c);
+			out += esc;
+		}
+		else
+		{
+			out += (char)c;
+		}
+	}
+	out += '"';
+	return out;
+}
+
+static const char* kind_name(uint8_t _kinds)
+{
+	switch (_kinds)
+	{
+	case 1 << BCDEC_STR_KGC:
+		return "kgc";
+	case 1 << BCDEC_STR_KTAB:
+		return "ktab";
+	default:
+		return "both";
+	}
+}
+
+
+void BCStringPool::add_file(const std::string& _module, const BCFileStrings& _fs)
+{
+	std::vector<uint32_t> refs(_fs.strs.size());
+	std::lock_guard<std::mutex> lock(mtx);
+	for (size_t i = 0; i < _fs.strs.size(); ++i)
+	{
+		auto ins = ids.insert(std::make_pair(_fs.strs[i], (uint32_t)entries.size()));
+		if (ins.second)
+		{
+			Entry e;
+			e.str = &ins.first->first;
+			entries.push_back(e);
+		}
+		Entry& e = entries[ins.first->second];
+		e.uses += _fs.uses[i];
+		e.files++;
+		e.kinds |= _fs.kinds[i];
+		total_uses += _fs.uses[i];
+		total_bytes += (uint64_t)_fs.uses[i] * _fs.strs[i].length();
+		refs[i] = ins.first->second;
+	}
+	files.push_back(std::make_pair(_module, std::move(refs)));
+}
+
+// Ids of the pooled strings, most used first.
+std::vector<uint32_t> BCStringPool::pool_order() const
+{
+	std::vector<uint32_t> order;
+	for (size_t i = 0; i < entries.size(); ++i)
+	{
+		if (entries[i].files >= 2)
+		{
+			order.push_back((uint32_t)i);
+		}
+	}
+	std::sort(order.begin(), order.end(), [this](uint32_t _l, uint32_t _r)
+	{
+		const Entry& l = entries[_l];
+		const Entry& r = entries[_r];
+		return l.uses != r.uses ? l.uses > r.uses : *l.str < *r.str;
+	});
+	return order;
+}
+
+void BCStringPool::print_summary() const
+{
+	uint64_t unique_bytes = 0, shared = 0, shared_bytes = 0;
+	for (size_t i = 0; i < entries.size(); ++i)
+	{
+		unique_bytes += entries[i].str->length();
+		if (entries[i].files >= 2)
+		{
+			shared++;
+			shared_bytes += entries[i].uses * entries[i].str->length();
+		}
+	}
+	printf("strings: %llu constants (%.2f MB) in %u files, %u distinct (%.2f MB), %llu shared by 2+ files (%.2f MB of constants)\n",
+		(unsigned long long)total_uses, total_bytes / 1048576.0, (unsigned)files.size(),
+		(unsigned)entries.size(), unique_bytes / 1048576.0, (unsigned long long)shared, shared_bytes / 1048576.0);
+	printf("strings: %.2f MB are repeats of a string stored elsewhere\n", (total_bytes - unique_bytes) / 1048576.0);
+}
+
+// One line per distinct string, by bytes a shared copy would save.
+bool BCStringPool::write_report(const std::string& _path) const
+{
+	std::vector<uint32_t> order(entries.size());
+	for (size_t i = 0; i < order.size(); ++i)
+	{
+		order[i] = (uint32_t)i;
+	}
+	auto saved = [this](uint32_t _id)
+	{
+		return (entries[_id].uses - 1) * entries[_id].str->length();
+	};
+	std::sort(order.begin(), order.end(), [&](uint32_t _l, uint32_t _r)
+	{
+		uint64_t l = saved(_l), r = saved(_r);
+		return l != r ? l > r : *entries[_l].str < *entries[_r].str;
+	});
+	std::ofstream ofs(_path.c_str(), std::ios::trunc);
+	ofs << "# " << total_uses << " constants, " << total_bytes << " bytes, " << files.size() << " files, "
+		<< entries.size() << " distinct\n";
+	ofs << "# uses\tfiles\tlength\tsaved\tkind\tstring\n";
+	for (size_t i = 0; i < order.size(); ++i)
+	{
+		const Entry& e = entries[order[i]];
+		ofs << e.uses << '\t' << e.files << '\t' << e.str->length() << '\t' << saved(order[i]) << '\t'
+			<< kind_name(e.kinds) << '\t' << escape_string(*e.str) << '\n';
+	}
+	ofs.close();
+	return !ofs.fail();
+}
+
+bool BCStringPool::write_pool(const std::string& _path) const
+{
+	std::vector<uint32_t> order = pool_order();
+	std::vector<uint32_t> pool_id(entries.size(), UINT32_MAX);
+	std::ofstream ofs(_path.c_str(), std::ios::binary | std::ios::trunc);
+	ofs.write(BCSTRPOOL_MAGIC, sizeof(BCSTRPOOL_MAGIC));
+	put_u32(ofs, (uint32_t)order.size());
+	for (size_t i = 0; i < order.size(); ++i)
+	{
+		const std::string& s = *entries[order[i]].str;
+		pool_id[order[i]] = (uint32_t)i;
+		put_u32(ofs, (uint32_t)s.length());
+		ofs.write(s.data(), (std::streamsize)s.length());
+	}
+	ofs.close();
+	if (ofs.fail())
+	{
+		return false;
+	}
+
+	std::vector<size_t> by_name(files.size());
+	for (size_t i = 0; i < by_name.size(); ++i)
+	{
+		by_name[i] = i;
+	}
+	std::sort(by_name.begin(), by_name.end(), [this](size_t _l, size_t _r) { return files[_l].first < files[_r].first; });
+	std::ofstream refs((_path + ".refs").c_str(), std::ios::trunc);
+	for (size_t i = 0; i < by_name.size(); ++i)
+	{
+		const std::vector<uint32_t>& ids_of = files[by_name[i]].second;
+		refs << files[by_name[i]].first << '\t';
+		bool first = true;
+		for (size_t k = 0; k < ids_of.size(); ++k)
+		{
+			if (pool_id[ids_of[k]] == UINT32_MAX)
+			{
+				continue;
+			}
+			refs << (first ? "" : " ") << pool_id[ids_of[k]];
+			first = false;
+		}
+		refs << '\n';
+	}
+	refs.close();
+	return !refs.fail();
+}
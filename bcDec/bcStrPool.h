@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Pool file layout, all integers little endian:
+//   "BCDSTRP1", u32 count
+//   strings, back to back: u32 len, bytes
+// A string's id is its position, most used first. Only strings used by two
+// or more files are pooled. PoolFile.refs lists per module, one line each:
+//   module<TAB>id id ...
+// the pooled strings its constants use, in order of first use.
+
+// String constants of one file, each distinct string once.
+struct BCFileStrings
+{
+	std::vector<std::string> strs;
+	std::vector<uint32_t> uses;  // Occurrences in the file.
+	std::vector<uint8_t> kinds;  // Bit mask of 1 << BCDEC_STR_*.
+};
+
+// Gathers string constants across a corpus.
+class BCStringPool
+{
+public:
+	BCStringPool() : total_uses(0), total_bytes(0) {}
+
+	// Thread safe.
+	void add_file(const std::string& _module, const BCFileStrings& _fs);
+
+	void print_summary() const;
+	bool write_report(const std::string& _path) const;
+	bool write_pool(const std::string& _path) const;
+
+private:
+	struct Entry
+	{
+		const std::string* str = nullptr;
+		uint64_t uses = 0;
+		uint32_t files = 0;
+		uint8_t kinds = 0;
+	};
+
+	std::vector<uint32_t> pool_order() const;
+
+	std::unordered_map<std::string, uint32_t> ids;
+	std::vector<Entry> entries;
+	std::vector<std::pair<std::string, std::vector<uint32_t>>> files;
+	uint64_t total_uses;
+	uint64_t total_bytes;
+	std::mutex mtx;
+};
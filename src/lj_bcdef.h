@@ -1,220 +0,0 @@
-/* This is a generated file. DO NOT EDIT! */
-
-LJ_DATADEF const uint16_t lj_bc_ofs[] = {
-0,
-65,
-130,
-195,
-260,
-387,
-517,
-577,
-637,
-701,
-765,
-816,
-866,
-916,
-966,
-1006,
-1046,
-1073,
-1101,
-1132,
-1163,
-1218,
-1291,
-1340,
-1389,
-1438,
-1487,
-1541,
-1590,
-1639,
-1688,
-1737,
-1769,
-1829,
-1889,
-1949,
-2009,
-2052,
-2134,
-2222,
-2255,
-2288,
-2317,
-2344,
-2367,
-2409,
-2449,
-2532,
-2610,
-2646,
-2678,
-2728,
-2798,
-2911,
-2998,
-3014,
-3030,
-3179,
-3305,
-3408,
-3466,
-3638,
-3877,
-4003,
-4145,
-4234,
-4279,
-4320,
-4324,
-4468,
-4543,
-4711,
-4899,
-4986,
-4990,
-5119,
-5206,
-5311,
-5398,
-5493,
-5512,
-5581,
-5647,
-5666,
-5709,
-5747,
-5766,
-5783,
-5813,
-5837,
-5856,
-5917,
-5970,
-5970,
-6087,
-6088,
-6170,
-8091,
-8162,
-8638,
-8758,
-8815,
-8946,
-8211,
-8353,
-8443,
-8510,
-8538,
-9004,
-9044,
-9688,
-9099,
-9421,
-9738,
-9856,
-9877,
-9898,
-9968,
-10010,
-10052,
-10094,
-10136,
-10178,
-10220,
-10262,
-10304,
-10346,
-10388,
-10662,
-10806,
-9926,
-10493,
-10430,
-10556,
-10619,
-10902,
-10955,
-11576,
-11945,
-11896,
-12010,
-12082,
-12157,
-12232,
-12307,
-11626,
-11716,
-11806,
-11008,
-11055,
-11169,
-11330,
-11412,
-11494
-};
-
-LJ_DATADEF const uint16_t lj_bc_mode[] = {
-BCDEF(BCMODE)
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF,
-BCMODE_FF
-};
-
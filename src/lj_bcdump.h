@@ -8,6 +8,7 @@
 
 #include "lj_obj.h"
 #include "lj_lex.h"
+#include "lj_bc.h"
 
 /* -- Bytecode dump format ------------------------------------------------ */
 
@@ -58,6 +59,53 @@ enum {
   BCDUMP_KTAB_INT, BCDUMP_KTAB_NUM, BCDUMP_KTAB_STR
 };
 
+/* Input kinds reported by lj_bcprobe_mod. */
+enum {
+  BCPROBE_INVALID, BCPROBE_SOURCE, BCPROBE_STANDARD, BCPROBE_OBFUSCATED
+};
+
+/* Header fields of an obfuscated prototype, in BCObfProfile.hdr. */
+enum {
+  BCOBF_FRAMESIZE, BCOBF_FLAGS, BCOBF_NUMPARAMS, BCOBF_SIZEUV
+};
+
+/* Obfuscation profile of a client format, installed by lj_bcprofile_mod.
+** Instruction operand bytes are decoded as b ^ key ^ (index & idx) and
+** string bytes as b ^ strkey ^ (offset & stridx).
+*/
+typedef struct BCObfProfile {
+  uint8_t opmap[BC__MAX];	/* Standard opcode of each dump opcode. */
+  uint8_t hdr[4];	/* BCOBF_* field stored in each header byte. */
+  uint8_t hdrchain;	/* Header bytes are XORed with the previous field. */
+  uint8_t knsizefirst;	/* numknU precedes numkgcU. */
+  uint8_t knfirst;	/* knum* precedes kgc*. */
+  uint8_t hashfirst;	/* Template tables store the hash size first. */
+  uint8_t inskey[3];	/* A, B and C operands. */
+  uint8_t insidx[3];
+  uint8_t strkey;
+  uint8_t stridx;
+  uint8_t kgc[BCDUMP_KGC_STR];	/* Dump code of each BCDUMP_KGC_* type. */
+  uint8_t kgcstr;	/* Dump code of an empty string constant. */
+} BCObfProfile;
+
+/* One prototype record of a dump, as indexed by lj_bcindex_mod. Records
+** are in dump order, so a prototype's children come before it and its
+** subtree is the range first..itself.
+*/
+typedef struct BCProtoRec {
+  uint32_t pos;		/* Start of the record, i.e. of its length prefix. */
+  uint32_t ofs;		/* Start of the record body. */
+  uint32_t len;		/* Length of the record body. */
+  uint32_t first;	/* First record of this prototype's subtree. */
+  uint32_t nchild;	/* Number of child prototypes. */
+  uint32_t sizebc, sizekgc, sizekn;
+  uint8_t flags, numparams, framesize, sizeuv;
+} BCProtoRec;
+
+/* Called by lj_bcscan_mod for each prototype record. */
+typedef void (*BCScanFn)(void *ud, const BCProtoRec *r, const BCIns *bc,
+			 const uint8_t *kgct);
+
 /* -- Bytecode reader/writer ---------------------------------------------- */
 
 #ifdef __cplusplus
@@ -71,7 +119,23 @@ LJ_FUNC GCproto *lj_bcread_proto(LexState *ls);
 LJ_FUNC GCproto *lj_bcread(LexState *ls);
 
 // az_5.1
+GCproto *lj_bcread_proto_mod(LexState *ls);
 GCproto *lj_bcread_mod(LexState *ls);
+GCproto *lj_bcread_any_mod(LexState *ls);
+int lj_bcprobe_mod(const char *in, size_t n);
+size_t lj_bctrans_mod(const char *in, size_t n, char *out);
+size_t lj_bctrans_proto_mod(const char *in, size_t n, const BCProtoRec *r,
+			    char *out);
+size_t lj_bctrans_head_mod(const char *in, size_t n, const BCProtoRec *main,
+			   char *out);
+const uint8_t *lj_bcopmap_mod(void);
+void lj_bcstrdec_init(void);
+void lj_bcstrdec_mod(uint8_t *q, const uint8_t *p, MSize len);
+MSize lj_bcindex_mod(const char *in, size_t n, BCProtoRec *rec, MSize max);
+MSize lj_bcscan_mod(const char *in, size_t n, BCIns *bc, uint8_t *kgct,
+		    BCScanFn fn, void *ud);
+int lj_bcprofile_mod(const BCObfProfile *pf);
+void lj_bcgetprofile_mod(BCObfProfile *pf);
 
 #ifdef __cplusplus
 };
@@ -23,25 +23,75 @@
 #include "lj_state.h"
 #include "lj_strfmt.h"
 
+#if LJ_TARGET_X86ORX64
 #include <emmintrin.h>
-#include <tmmintrin.h>
-#include "defs.h"
-
-//	Ϊm128ֵ
-#define LD128(m128_array) _mm_loadu_si128((__m128i *)m128_array)
-
-static const uint8_t xmmword_94570[] = { 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00 };
-static const uint8_t xmmword_94560[] = { 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 };
-static const uint8_t xmmword_943A0[] = { 0x00, 0x01, 0x04, 0x05, 0x08, 0x09, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 };
-static const uint8_t xmmword_943B0[] = { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x04, 0x05, 0x08, 0x09, 0x0C, 0x0D };
-static const uint8_t xmmword_943C0[] = { 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00 };
-static const uint8_t xmmword_94580[] = { 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 };
-static const uint8_t xmmword_94320[] = { 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00 };
-static const uint8_t xmmword_94590[] = { 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 };
-static const uint8_t xmmword_945A0[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+#include <immintrin.h>
+#endif
 
 //	opcode Ӧϵ
 static const uint8_t op_map[] = { 12,13,14,15,16,17,39,40,41,42,43,44,77,78,79,80,81,82,83,84,85,86,87,88,0,1,2,3,4,5,6,7,8,9,10,11,65,66,67,68,69,70,71,72,18,19,20,21,73,74,75,76,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,64,60,61,62,63,96,89,90,91,92,93,94,95 };
+LJ_STATIC_ASSERT(sizeof(op_map) == BC__MAX);
+
+/* -- Obfuscation profile ------------------------------------------------- */
+
+#define BCOBF_KGC_BAD	(~(MSize)0)
+
+/* Active obfuscation profile, in the form the readers use. Starts out as
+** the built-in profile: op_map, header bytes XOR chained in the order
+** framesize, flags, numparams, sizeuv, number constants first, hash size
+** first, A inverted, B XORed with the instruction index, standard GC
+** constant codes and strings decoded with ~(p[i] ^ i).
+*/
+static struct {
+	const uint8_t *opmap;	/* Standard opcode of each dump opcode. */
+	uint32_t inskey;	/* Operand keys at their instruction word position. */
+	uint32_t insidx;	/* Index masks at their instruction word position. */
+	uint8_t hdr[4];		/* BCOBF_* field stored in each header byte. */
+	uint8_t chain;		/* 0xff if the header is XOR chained. */
+	uint8_t knsizefirst, knfirst, hashfirst;
+	uint8_t strkey, stridx;
+	uint8_t kgcstr;		/* Dump code of an empty string constant. */
+	uint8_t kgcmap[256];	/* BCDUMP_KGC_* type of each code below kgcstr. */
+} bcobf = {
+	op_map, 0x0000ff00u, 0xff000000u,
+	{ BCOBF_FRAMESIZE, BCOBF_FLAGS, BCOBF_NUMPARAMS, BCOBF_SIZEUV },
+	0xff, 1, 1, 1, 0xff, 0xff, BCDUMP_KGC_STR,
+	{ BCDUMP_KGC_CHILD, BCDUMP_KGC_TAB, BCDUMP_KGC_I64, BCDUMP_KGC_U64,
+		BCDUMP_KGC_COMPLEX }
+};
+
+/* Storage for the opcode table of an installed profile. */
+static uint8_t bcobf_opmap[BC__MAX];
+
+/* Opcode permutation, for tools that produce obfuscated dumps. */
+const uint8_t *lj_bcopmap_mod(void)
+{
+	return bcobf.opmap;
+}
+
+/* Undo the header permutation and XOR chain into f[BCOBF_*]. */
+static LJ_AINLINE void bcobf_header(const uint8_t *h, MSize *f)
+{
+	MSize v = 0;
+	int j;
+	for (j = 0; j < 4; j++) {
+		v = h[j] ^ (v & bcobf.chain);
+		f[bcobf.hdr[j]] = v;
+	}
+}
+
+/* Operand key of the instruction at index i, at word positions. */
+static LJ_AINLINE uint32_t bcobf_inskey(MSize i)
+{
+	return bcobf.inskey ^ ((i & 0xff) * 0x01010100u & bcobf.insidx);
+}
+
+/* Map a dump GC constant code to its BCDUMP_KGC_* type. */
+static LJ_AINLINE MSize bcobf_kgctype(MSize tp)
+{
+	if (tp >= bcobf.kgcstr) return tp - bcobf.kgcstr + BCDUMP_KGC_STR;
+	return bcobf.kgcmap[tp] < BCDUMP_KGC_STR ? bcobf.kgcmap[tp] : BCOBF_KGC_BAD;
+}
 
 
 /* Reuse some lexer fields for our own purposes. */
@@ -51,6 +101,18 @@ static const uint8_t op_map[] = { 12,13,14,15,16,17,39,40,41,42,43,44,77,78,79,8
 #define bcread_oldtop(L, ls)	restorestack(L, ls->lastline)
 #define bcread_savetop(L, ls, top) \
   ls->lastline = (BCLine)savestack(L, (top))
+#define bcread_pos(ls)		ls->linenumber	/* Input offset of ls->pe. */
+#define bcread_sec(ls)		ls->tok		/* Section being read. */
+
+/* Dump sections, named in error messages. */
+enum {
+	BCREAD_SEC_HEADER, BCREAD_SEC_BC, BCREAD_SEC_UV, BCREAD_SEC_KGC,
+	BCREAD_SEC_KNUM, BCREAD_SEC_DBG
+};
+
+static const char *const bcread_secname[] = {
+	"header", "bc", "uv", "kgc", "knum", "dbg"
+};
 
 /* -- Input buffer handling ----------------------------------------------- */
 
@@ -61,17 +123,9 @@ static LJ_NOINLINE void bcread_error(LexState *ls, ErrMsg em)
 	const char *name = ls->chunkarg;
 	if (*name == BCDUMP_HEAD1) name = "(binary)";
 	else if (*name == '@' || *name == '=') name++;
-	lj_strfmt_pushf(L, "%s: %s", name, err2msg(em));
-	lj_err_throw(L, LUA_ERRSYNTAX);
-}
-
-/* Throw reader error. */
-static void bcread_error_mod(lua_State *L, const char *chunkarg)
-{
-	const char *name = chunkarg;
-	if (*name == BCDUMP_HEAD1) name = "(binary)";
-	else if (*name == '@' || *name == '=') name++;
-	lj_strfmt_pushf(L, "%s: %s", chunkarg);
+	lj_strfmt_pushf(L, "%s: %s (%s at offset %d)", name, err2msg(em),
+		bcread_secname[bcread_sec(ls)],
+		(int32_t)(bcread_pos(ls) - (BCLine)(ls->pe - ls->p)));
 	lj_err_throw(L, LUA_ERRSYNTAX);
 }
 
@@ -107,6 +161,7 @@ static LJ_NOINLINE void bcread_fill(LexState *ls, MSize len, int need)
 			ls->c = -1;  /* Only bad if we get called again. */
 			break;
 		}
+		bcread_pos(ls) += (BCLine)sz;
 		if (n) {  /* Append to buffer. */
 			n += (MSize)sz;
 			p = lj_buf_need(&ls->sb, n < len ? len : n);
@@ -137,12 +192,21 @@ static LJ_AINLINE void bcread_want(LexState *ls, MSize len)
 		bcread_fill(ls, len, 0);
 }
 
+/* Throw unless len more bytes are in the buffer. While a prototype is
+** read, ls->pe is the end of its record, so nothing can read past it.
+*/
+static LJ_AINLINE void bcread_check(LexState *ls, MSize len)
+{
+	if (LJ_UNLIKELY((MSize)(ls->pe - ls->p) < len))
+		bcread_error(ls, LJ_ERR_BCBAD);
+}
+
 /* Return memory block from buffer. */
 static LJ_AINLINE uint8_t *bcread_mem(LexState *ls, MSize len)
 {
 	uint8_t *p = (uint8_t *)ls->p;
+	bcread_check(ls, len);
 	ls->p += len;
-	lua_assert(ls->p <= ls->pe);
 	return p;
 }
 
@@ -155,35 +219,119 @@ static void bcread_block(LexState *ls, void *q, MSize len)
 /* Read byte from buffer. */
 static LJ_AINLINE uint32_t bcread_byte(LexState *ls)
 {
-	lua_assert(ls->p < ls->pe);
+	bcread_check(ls, 1);
 	return (uint32_t)(uint8_t)*ls->p++;
 }
 
-/* Read ULEB128 value from buffer. */
+/* Decode a ULEB128 value that starts at p, with at least 8 bytes readable.
+** The continuation bits of all 8 bytes are tested at once and the 7 bit
+** groups are merged with shifts, so a multi-byte number constant needs no
+** loop. Returns the length, or 0 if none of the first 5 bytes ends the
+** value. v gets up to 35 bits.
+*/
+#if LJ_LE
+static LJ_AINLINE MSize bcread_uleb128_word(const uint8_t *p, uint64_t *v)
+{
+	uint64_t x, stop;
+	uint32_t lo;
+	MSize n;
+	memcpy(&x, p, 8);
+	stop = ~x & U64x(00000080,80808080);
+	if (LJ_UNLIKELY(!stop)) return 0;
+	lo = (uint32_t)stop;
+	n = lo ? (lj_ffs(lo) >> 3) + 1 : 5;
+	x &= ((uint64_t)1 << (n*8)) - 1;
+	*v = (x & 0x7f) | ((x >> 1) & 0x3f80) | ((x >> 2) & 0x1fc000) |
+	     ((x >> 3) & 0xfe00000) | ((x >> 4) & U64x(00000007,f0000000));
+	return n;
+}
+#endif
+
+/* Read ULEB128 value from buffer. At most 5 bytes. */
 static LJ_AINLINE uint32_t bcread_uleb128(LexState *ls)
 {
-	uint32_t v = lj_buf_ruleb128(&ls->p);
-	lua_assert(ls->p <= ls->pe);
+	const uint8_t *p = (const uint8_t *)ls->p, *pe = (const uint8_t *)ls->pe;
+	uint32_t v;
+	if (LJ_UNLIKELY(p >= pe)) bcread_error(ls, LJ_ERR_BCBAD);
+	v = *p++;
+	if (LJ_UNLIKELY(v >= 0x80)) {
+		int sh = 0;
+		v &= 0x7f;
+		do {
+			if (LJ_UNLIKELY(p >= pe || sh >= 28)) bcread_error(ls, LJ_ERR_BCBAD);
+			v |= ((uint32_t)(*p & 0x7f) << (sh += 7));
+		} while (*p++ >= 0x80);
+	}
+	ls->p = (const char *)p;
 	return v;
 }
 
+/* Read ULEB128 value of a number constant. The halves of a double mostly
+** take 5 bytes, so the value is merged from one word when 8 bytes are left.
+*/
+static LJ_AINLINE uint32_t bcread_uleb128_num(LexState *ls)
+{
+#if LJ_LE
+	const uint8_t *p = (const uint8_t *)ls->p;
+	if (LJ_LIKELY((const uint8_t *)ls->pe - p >= 8)) {
+		uint64_t w;
+		MSize n = bcread_uleb128_word(p, &w);
+		if (LJ_UNLIKELY(!n)) bcread_error(ls, LJ_ERR_BCBAD);
+		ls->p = (const char *)(p + n);
+		return (uint32_t)w;
+	}
+#endif
+	return bcread_uleb128(ls);
+}
+
 /* Read top 32 bits of 33 bit ULEB128 value from buffer. */
 static uint32_t bcread_uleb128_33(LexState *ls)
 {
-	const uint8_t *p = (const uint8_t *)ls->p;
-	uint32_t v = (*p++ >> 1);
+	const uint8_t *p = (const uint8_t *)ls->p, *pe = (const uint8_t *)ls->pe;
+	uint32_t v;
+#if LJ_LE
+	if (LJ_LIKELY(pe - p >= 8)) {
+		uint64_t w;
+		MSize n = bcread_uleb128_word(p, &w);
+		if (LJ_UNLIKELY(!n)) bcread_error(ls, LJ_ERR_BCBAD);
+		ls->p = (const char *)(p + n);
+		return (uint32_t)(w >> 1);
+	}
+#endif
+	if (LJ_UNLIKELY(p >= pe)) bcread_error(ls, LJ_ERR_BCBAD);
+	v = (*p++ >> 1);
 	if (LJ_UNLIKELY(v >= 0x40)) {
 		int sh = -1;
 		v &= 0x3f;
 		do {
-			v |= ((*p & 0x7f) << (sh += 7));
+			if (LJ_UNLIKELY(p >= pe || sh >= 27)) bcread_error(ls, LJ_ERR_BCBAD);
+			v |= ((uint32_t)(*p & 0x7f) << (sh += 7));
 		} while (*p++ >= 0x80);
 	}
-	ls->p = (char *)p;
-	lua_assert(ls->p <= ls->pe);
+	ls->p = (const char *)p;
 	return v;
 }
 
+/* Throw if the arrays of a prototype cannot fit into the rest of its
+** record. Every element takes at least one byte, so this rejects bogus
+** sizes before they turn into huge allocations.
+*/
+static void bcread_checksizes(LexState *ls, MSize sizebc, MSize sizeuv,
+	MSize sizekgc, MSize sizekn, MSize sizedbg)
+{
+	uint64_t need = (uint64_t)(MSize)(sizebc - 1) * 4 + (uint64_t)sizeuv * 2 +
+		sizekgc + sizekn + sizedbg;
+	if (sizebc == 0 || need > (uint64_t)(ls->pe - ls->p))
+		bcread_error(ls, LJ_ERR_BCBAD);
+}
+
+/* Same for a template table. Entries take at least one byte, pairs two. */
+static void bcread_checktab(LexState *ls, MSize narray, MSize nhash)
+{
+	if ((uint64_t)narray + (uint64_t)nhash * 2 > (uint64_t)(ls->pe - ls->p))
+		bcread_error(ls, LJ_ERR_BCBAD);
+}
+
 /* -- Bytecode reader ----------------------------------------------------- */
 
 /* Read debug info of a prototype. */
@@ -205,165 +353,6 @@ static void bcread_dbg(LexState *ls, GCproto *pt, MSize sizedbg)
 	}
 }
 
-
-void bcread_dbg_mod(unsigned int ls, int pt, unsigned int sizedbg)
-{
-	unsigned int v3; // ecx
-	char *v4; // esi
-	__m128i *v5; // ebp
-	int v6; // edi
-	int v7; // edx
-	unsigned int v8; // ecx
-	unsigned int v9; // esi
-	const __m128i *v10; // edx
-	unsigned int v11; // edi
-	__m128i v12; // xmm4
-	__m128i v13; // xmm3
-	__m128i v14; // xmm0
-	int v15; // edx
-	_WORD *v16; // edx
-	int v17; // edx
-	int v18; // edx
-	unsigned int v19; // eax
-	char v20; // dl
-	__int16 v21; // dx
-	int v22; // [esp-20h] [ebp-20h]
-
-	__m128i xmmword_9B0B0 = _mm_set_epi8(0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x0D, 0x0C, 0x09, 0x08, 0x05, 0x04, 0x01, 0x00);
-	__m128i xmmword_9B0C0 = _mm_set_epi8(0x0D, 0x0C, 0x09, 0x08, 0x05, 0x04, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80);
-
-
-	v3 = sizedbg;
-	v4 = *(char **)(ls + 24);
-	v5 = *(__m128i **)(pt + 52);
-	*(char **)(ls + 24) = &v4[sizedbg];
-	v6 = (int)v5;
-	v22 = pt;
-	if (sizedbg >= 8)
-	{
-		if ((unsigned __int8)v5 & 1)
-		{
-			v20 = *v4;
-			v6 = (int)v5->m128i_i32 + 1;
-			++v4;
-			v3 = sizedbg - 1;
-			LOBYTE(v5->m128i_i32[0]) = v20;
-		}
-		if (v6 & 2)
-		{
-			v21 = *(_WORD *)v4;
-			v6 += 2;
-			v4 += 2;
-			v3 -= 2;
-			*(_WORD *)(v6 - 2) = v21;
-		}
-		if (v6 & 4)
-		{
-			v17 = *(_DWORD *)v4;
-			v6 += 4;
-			v4 += 4;
-			v3 -= 4;
-			*(_DWORD *)(v6 - 4) = v17;
-		}
-	}
-	qmemcpy((void *)v6, v4, v3);
-	if (*(_BYTE *)(ls + 108) & 1)
-	{
-		ls = *(_DWORD *)(v22 + 48);
-		if (ls > 255)
-		{
-			v7 = *(_DWORD *)(v22 + 8);
-			v8 = v7 - 1;
-			if (ls > 0xFFFF)
-			{
-				v18 = (int)&v5->m128i_i32[v7 - 1];
-				if (v8)
-				{
-					do
-					{
-						v19 = v5->m128i_i32[0];
-						v5 = (__m128i *)((char *)v5 + 4);
-						ls = _byteswap_ulong(v19);
-						v5[-1].m128i_i32[3] = ls;
-					} while (v5 != (__m128i *)v18);
-				}
-			}
-			else
-			{
-				if (v7 == 1)
-					return;
-				v9 = ((unsigned int)(v7 - 9) >> 3) + 1;
-				ls = 8 * v9;
-				if ((unsigned int)(v7 - 2) <= 6)
-				{
-					ls = 0;
-				}
-				else
-				{
-					v10 = v5;
-					v11 = 0;
-					v12 = xmmword_9B0B0;
-					v13 = xmmword_9B0C0;
-					do
-					{
-						v14 = _mm_loadu_si128(v10);
-						++v11;
-						++v10;
-						_mm_storeu_si128(
-							(__m128i *)&v10[-1],
-							_mm_or_si128(
-								_mm_srli_epi16(v14, 8u),
-								_mm_or_si128(
-									_mm_shuffle_epi8(_mm_slli_epi32(_mm_unpackhi_epi16(v14, _mm_setzero_si128()), 8u), v13),
-									_mm_shuffle_epi8(_mm_slli_epi32(_mm_unpacklo_epi16(v14, _mm_setzero_si128()), 8u), v12))));
-					} while (v9 > v11);
-					if (v8 == ls)
-						return;
-				}
-				*((_WORD *)v5->m128i_i32 + ls) = (*((_WORD *)v5->m128i_i32 + ls) << 8) | (*((_WORD *)v5->m128i_i32 + ls) >> 8);
-				if (v8 > ls + 1)
-				{
-					*((_WORD *)v5->m128i_i32 + ls + 1) = (*((_WORD *)v5->m128i_i32 + ls + 1) << 8) | (*((_WORD *)v5->m128i_i32
-						+ ls
-						+ 1) >> 8);
-					if (v8 > ls + 2)
-					{
-						*((_WORD *)v5->m128i_i32 + ls + 2) = (*((_WORD *)v5->m128i_i32 + ls + 2) << 8) | (*((_WORD *)v5->m128i_i32
-							+ ls
-							+ 2) >> 8);
-						if (v8 > ls + 3)
-						{
-							*((_WORD *)v5->m128i_i32 + ls + 3) = (*((_WORD *)v5->m128i_i32 + ls + 3) << 8) | (*((_WORD *)v5->m128i_i32
-								+ ls
-								+ 3) >> 8);
-							if (v8 > ls + 4)
-							{
-								*((_WORD *)v5->m128i_i32 + ls + 4) = (*((_WORD *)v5->m128i_i32 + ls + 4) << 8) | (*((_WORD *)v5->m128i_i32
-									+ ls
-									+ 4) >> 8);
-								v15 = ls + 5;
-								if (v8 > ls + 5)
-								{
-									ls += 6;
-									*((_WORD *)v5->m128i_i32 + v15) = (*((_WORD *)v5->m128i_i32 + v15) << 8) | (*((_WORD *)v5->m128i_i32
-										+ v15) >> 8);
-									if (v8 > ls)
-									{
-										v16 = (_WORD *)((char *)v5->m128i_i32 + 2 * ls);
-										ls = ((unsigned __int16)*v16 << 8) | ((unsigned int)(unsigned __int16)*v16 >> 8);
-										*v16 = ls;
-									}
-								}
-							}
-						}
-					}
-				}
-			}
-		}
-	}
-	return;
-}
-
 /* Find pointer to varinfo. */
 static const void *bcread_varinfo(GCproto *pt)
 {
@@ -386,8 +375,8 @@ static void bcread_ktabk(LexState *ls, TValue *o)
 		setintV(o, (int32_t)bcread_uleb128(ls));
 	}
 	else if (tp == BCDUMP_KTAB_NUM) {
-		o->u32.lo = bcread_uleb128(ls);
-		o->u32.hi = bcread_uleb128(ls);
+		o->u32.lo = bcread_uleb128_num(ls);
+		o->u32.hi = bcread_uleb128_num(ls);
 	}
 	else {
 		lua_assert(tp <= BCDUMP_KTAB_TRUE);
@@ -395,158 +384,224 @@ static void bcread_ktabk(LexState *ls, TValue *o)
 	}
 }
 
-double* bcread_ktabk_mod(int ls, double *o)
-{
-	int v2; // ebp
-	char **v3; // esi
-	unsigned int v4; // eax
-	__m128i *v5; // esi
-	size_t v6; // ecx
-	unsigned int v7; // edi
-	unsigned int v13; // eax
-	__m128i v14; // xmm0
-	__m128i v15; // xmm1
-	int v16; // edx
-	double *result; // eax
-	int v18; // eax
-	unsigned int v19; // edx
-	double v20; // xmm0_8
-	double *v21; // [esp+14h] [ebp-28h]
-	unsigned int v22; // [esp+18h] [ebp-24h]
-	__m128i v8;
-	__m128i v9;
-	__m128i v10;
-	__m128i v11;
-	__m128i v12;
-
-	v2 = ls;
-	v3 = (char **)(ls + 24);
-	v21 = o;
-	v4 = lj_buf_ruleb128((const char **)(ls + 24));
-	if (v4 > 4)
-	{
-		v5 = *(__m128i **)(v2 + 24);
-		v6 = v4 - 5;
-		*(_DWORD *)(v2 + 24) = (uint32_t)((char *)v5 + v4 - 5);
-		if (v4 != 5)
-		{
-			v22 = ((v4 - 21) >> 4) + 1;
-			if (v4 - 6 <= 0xE)
-			{
-				v16 = 0;
-			}
-			else
-			{
-				v7 = 0;
-				v8 = LD128(xmmword_94570);
-				v9 = LD128(xmmword_94560);
-				v10 = LD128(xmmword_943A0);
-				v11 = LD128(xmmword_943B0);
-				v12 = LD128(&xmmword_943C0);
-				do
-				{
-					v13 = v7++;
-					v14 = _mm_and_si128(
-						_mm_or_si128(
-							_mm_shuffle_epi8(_mm_add_epi32(_mm_load_si128((const __m128i *)&xmmword_94580), v9), v11),
-							_mm_shuffle_epi8(v9, v10)),
-						v12);
-					v15 = _mm_or_si128(
-						_mm_shuffle_epi8(_mm_add_epi32(_mm_load_si128((const __m128i *)&xmmword_94320), v9), v11),
-						_mm_shuffle_epi8(_mm_add_epi32(_mm_load_si128((const __m128i *)&xmmword_94590), v9), v10));
-					v9 = _mm_add_epi32(v9, v8);
-					_mm_storeu_si128(
-						&v5[v13],
-						_mm_xor_si128(
-							_mm_xor_si128(_mm_packus_epi16(v14, _mm_and_si128(v15, v12)), _mm_loadu_si128(&v5[v13])),
-							LD128(xmmword_945A0)));
-				} while (v22 > v7);
-				v16 = 16 * v22;
-				if (v6 == 16 * v22)
-					goto LABEL_7;
-			}
-			v5[v16 / 0x10u].m128i_i8[0] = ~(v5[v16 / 0x10u].m128i_i8[0] ^ v16);
-			if (v6 > (size_t)(v16 + 1))
-			{
-				v5[v16 / 0x10u].m128i_i8[1] = ~(v5[v16 / 0x10u].m128i_i8[1] ^ (v16 + 1));
-				if (v6 > (size_t)(v16 + 2))
-				{
-					v5[v16 / 0x10u].m128i_i8[2] = ~(v5[v16 / 0x10u].m128i_i8[2] ^ (v16 + 2));
-					if (v6 > (size_t)(v16 + 3))
-					{
-						v5[v16 / 0x10u].m128i_i8[3] = ~(v5[v16 / 0x10u].m128i_i8[3] ^ (v16 + 3));
-						if (v6 > (size_t)(v16 + 4))
-						{
-							v5[v16 / 0x10u].m128i_i8[4] = ~(v5[v16 / 0x10u].m128i_i8[4] ^ (v16 + 4));
-							if (v6 > (size_t)(v16 + 5))
-							{
-								v5[v16 / 0x10u].m128i_i8[5] = ~(v5[v16 / 0x10u].m128i_i8[5] ^ (v16 + 5));
-								if (v6 > (size_t)(v16 + 6))
-								{
-									v5[v16 / 0x10u].m128i_i8[6] = ~(v5[v16 / 0x10u].m128i_i8[6] ^ (v16 + 6));
-									if (v6 > (size_t)(v16 + 7))
-									{
-										v5[v16 / 0x10u].m128i_i8[7] = ~(v5[v16 / 0x10u].m128i_i8[7] ^ (v16 + 7));
-										if (v6 > (size_t)(v16 + 8))
-										{
-											v5[v16 / 0x10u].m128i_i8[8] = ~(v5[v16 / 0x10u].m128i_i8[8] ^ (v16 + 8));
-											if (v6 > (size_t)(v16 + 9))
-											{
-												v5[v16 / 0x10u].m128i_i8[9] = ~(v5[v16 / 0x10u].m128i_i8[9] ^ (v16 + 9));
-												if (v6 > (size_t)(v16 + 10))
-												{
-													v5[v16 / 0x10u].m128i_i8[10] = ~(v5[v16 / 0x10u].m128i_i8[10] ^ (v16 + 10));
-													if (v6 > (size_t)(v16 + 11))
-													{
-														v5[v16 / 0x10u].m128i_i8[11] = ~(v5[v16 / 0x10u].m128i_i8[11] ^ (v16 + 11));
-														if (v6 > (size_t)(v16 + 12))
-														{
-															v5[v16 / 0x10u].m128i_i8[12] = ~(v5[v16 / 0x10u].m128i_i8[12] ^ (v16 + 12));
-															v18 = v16 + 13;
-															if (v6 > (size_t)(v16 + 13))
-															{
-																v19 = (uint32_t)(v16 + 14);
-																*((_BYTE *)v5->m128i_i32 + v18) = ~(*((_BYTE *)v5->m128i_i32 + v18) ^ v18);
-																if (v6 > v19)
-																	*((_BYTE *)v5->m128i_i32 + v19) = ~(*((_BYTE *)v5->m128i_i32 + v19) ^ v19);
-															}
-														}
-													}
-												}
-											}
-										}
-									}
-								}
-							}
-						}
-					}
-				}
-			}
-		}
-	LABEL_7:
-		result = (double *)lj_str_new((lua_State*)*(_DWORD *)(v2 + 4), (char*)v5, v6);
-		*((_DWORD *)v21 + 1) = -5;
-		*(_DWORD *)v21 = (uint32_t)result;
-		return result;
+/* -- String constant decoding ------------------------------------------- */
+
+/* Obfuscated string constants are decoded with q[i] = ~(p[i] ^ i), which is
+** p[i] ^ (~i & 0xff). The key for the bytes at offset i+j is ~j - i, so the
+** vector kernels keep one key vector and step it down per block. The tail is
+** loaded before anything is stored and written with an overlapping store,
+** which keeps all kernels safe for in-place decoding (q == p).
+** Other profiles decode with q[i] = p[i] ^ strkey ^ (i & stridx) through
+** the _key kernels, which rebuild the key for every block.
+*/
+typedef void (*StrDecFn)(uint8_t *q, const uint8_t *p, MSize len);
+
+static void strdec_scalar(uint8_t *q, const uint8_t *p, MSize len)
+{
+	MSize i;
+	for (i = 0; i < len; i++)
+		q[i] = (uint8_t)~(p[i] ^ (uint8_t)i);
+}
+
+static void strdec_scalar_key(uint8_t *q, const uint8_t *p, MSize len)
+{
+	uint8_t key = bcobf.strkey, idx = bcobf.stridx;
+	MSize i;
+	for (i = 0; i < len; i++)
+		q[i] = (uint8_t)(p[i] ^ key ^ ((uint8_t)i & idx));
+}
+
+#if LJ_TARGET_X86ORX64
+
+#if defined(__GNUC__)
+#define STRDEC_AVX2	__attribute__((target("avx2")))
+#define STRDEC_HAS_AVX2	1
+#elif defined(_MSC_VER) && _MSC_VER >= 1700
+#include <intrin.h>
+#define STRDEC_AVX2
+#define STRDEC_HAS_AVX2	1
+#endif
+
+/* Keys ~0 .. ~15 for one 16 byte block at offset 0. */
+#define STRDEC_KEY16 \
+	-1, -2, -3, -4, -5, -6, -7, -8, -9, -10, -11, -12, -13, -14, -15, -16
+
+/* Strings shorter than one block are decoded through a stack block. */
+static void strdec_short_sse2(uint8_t *q, const uint8_t *p, MSize len)
+{
+	uint8_t buf[16];
+	__m128i v;
+	memcpy(buf, p, len);
+	v = _mm_loadu_si128((const __m128i *)buf);
+	v = _mm_xor_si128(v, _mm_setr_epi8(STRDEC_KEY16));
+	_mm_storeu_si128((__m128i *)buf, v);
+	memcpy(q, buf, len);
+}
+
+static void strdec_sse2(uint8_t *q, const uint8_t *p, MSize len)
+{
+	__m128i key0 = _mm_setr_epi8(STRDEC_KEY16), key = key0, step, tail;
+	MSize i, last;
+	if (len < 16) {
+		strdec_short_sse2(q, p, len);
+		return;
+	}
+	last = len - 16;
+	tail = _mm_loadu_si128((const __m128i *)(p + last));
+	tail = _mm_xor_si128(tail, _mm_sub_epi8(key0, _mm_set1_epi8((char)last)));
+	step = _mm_set1_epi8(16);
+	for (i = 0; i < last; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(p + i));
+		_mm_storeu_si128((__m128i *)(q + i), _mm_xor_si128(v, key));
+		key = _mm_sub_epi8(key, step);
+	}
+	_mm_storeu_si128((__m128i *)(q + last), tail);
+}
+
+static void strdec_sse2_key(uint8_t *q, const uint8_t *p, MSize len)
+{
+	__m128i idx0, idx, m, c, step, tail;
+	MSize i, last;
+	if (len < 16) {
+		strdec_scalar_key(q, p, len);
+		return;
+	}
+	idx0 = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	idx = idx0;
+	m = _mm_set1_epi8((char)bcobf.stridx);
+	c = _mm_set1_epi8((char)bcobf.strkey);
+	last = len - 16;
+	tail = _mm_add_epi8(idx0, _mm_set1_epi8((char)last));
+	tail = _mm_xor_si128(_mm_and_si128(tail, m), c);
+	tail = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(p + last)), tail);
+	step = _mm_set1_epi8(16);
+	for (i = 0; i < last; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(p + i));
+		__m128i key = _mm_xor_si128(_mm_and_si128(idx, m), c);
+		_mm_storeu_si128((__m128i *)(q + i), _mm_xor_si128(v, key));
+		idx = _mm_add_epi8(idx, step);
+	}
+	_mm_storeu_si128((__m128i *)(q + last), tail);
+}
+
+#ifdef STRDEC_HAS_AVX2
+
+STRDEC_AVX2 static void strdec_avx2(uint8_t *q, const uint8_t *p, MSize len)
+{
+	__m256i key0, key, step, tail;
+	MSize i, last;
+	if (len < 32) {
+		strdec_sse2(q, p, len);
+		return;
+	}
+	key0 = _mm256_setr_epi8(STRDEC_KEY16,
+		-17, -18, -19, -20, -21, -22, -23, -24,
+		-25, -26, -27, -28, -29, -30, -31, -32);
+	key = key0;
+	last = len - 32;
+	tail = _mm256_loadu_si256((const __m256i *)(p + last));
+	tail = _mm256_xor_si256(tail, _mm256_sub_epi8(key0, _mm256_set1_epi8((char)last)));
+	step = _mm256_set1_epi8(32);
+	for (i = 0; i < last; i += 32) {
+		__m256i v = _mm256_loadu_si256((const __m256i *)(p + i));
+		_mm256_storeu_si256((__m256i *)(q + i), _mm256_xor_si256(v, key));
+		key = _mm256_sub_epi8(key, step);
+	}
+	_mm256_storeu_si256((__m256i *)(q + last), tail);
+}
+
+/* Check for AVX2 including OS support for the YMM state. */
+static int strdec_cpu_avx2(void)
+{
+#if defined(__GNUC__)
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+#else
+	int r[4];
+	__cpuid(r, 1);
+	if ((r[2] & (3 << 27)) != (3 << 27)) return 0;  /* OSXSAVE and AVX. */
+	if ((_xgetbv(0) & 6) != 6) return 0;  /* XMM and YMM state enabled. */
+	__cpuidex(r, 7, 0);
+	return (r[1] >> 5) & 1;
+#endif
+}
+#endif
+
+#endif
+
+/* Selected decode kernel. Scalar until lj_bcstrdec_init or
+** lj_bcprofile_mod picks one, which is right for the built-in profile.
+** Only written before any thread reads a dump, so it needs no lock.
+*/
+static StrDecFn strdec_kernel = strdec_scalar;
+
+/* Best kernel for this CPU and the active profile. */
+static StrDecFn strdec_select(void)
+{
+	StrDecFn fn = strdec_scalar;
+	if (bcobf.strkey != 0xff || bcobf.stridx != 0xff) {
+		fn = strdec_scalar_key;
+#if LJ_TARGET_X86ORX64
+		fn = strdec_sse2_key;
+#endif
+	} else {
+#if LJ_TARGET_X86ORX64
+		fn = strdec_sse2;  /* SSE2 is baseline for x64 and for our x86 builds. */
+#ifdef STRDEC_HAS_AVX2
+		if (strdec_cpu_avx2()) fn = strdec_avx2;
+#endif
+#endif
+	}
+	return fn;
+}
+
+/* Select the string decode kernel. Call before reading dumps on threads. */
+void lj_bcstrdec_init(void)
+{
+	strdec_kernel = strdec_select();
+}
+
+/* Decode an obfuscated string constant. May be in place. */
+static LJ_AINLINE void bcread_strdec_mod(uint8_t *q, const uint8_t *p, MSize len)
+{
+	strdec_kernel(q, p, len);
+}
+
+/* Same, callable from outside for benchmarks. */
+void lj_bcstrdec_mod(uint8_t *q, const uint8_t *p, MSize len)
+{
+	strdec_kernel(q, p, len);
+}
+
+/* Read and intern an obfuscated string constant. Decoded out of place,
+** so the input buffer stays untouched.
+*/
+static GCstr *bcread_kstr_mod(LexState *ls, MSize len)
+{
+	const uint8_t *p = bcread_mem(ls, len);
+	uint8_t *q = (uint8_t *)lj_buf_tmp(ls->L, len);
+	bcread_strdec_mod(q, p, len);
+	return lj_str_new(ls->L, (const char *)q, len);
+}
+
+/* Read a single constant key/value of an obfuscated template table. */
+static void bcread_ktabk_mod(LexState *ls, TValue *o)
+{
+	MSize tp = bcread_uleb128(ls);
+	if (tp >= BCDUMP_KTAB_STR) {
+		setstrV(ls->L, o, bcread_kstr_mod(ls, tp - BCDUMP_KTAB_STR));
 	}
-	if (v4 == 3)
-	{
-		v20 = (double)(signed int)lj_buf_ruleb128((const char **)v3);
-		result = v21;
-		*v21 = v20;
+	else if (tp == BCDUMP_KTAB_INT) {
+		setintV(o, (int32_t)bcread_uleb128(ls));
 	}
-	else if (v4 == 4)
-	{
-		*(_DWORD *)v21 = lj_buf_ruleb128((const char **)v3);
-		result = (double *)lj_buf_ruleb128((const char **)v3);
-		*((_DWORD *)v21 + 1) = (uint32_t)result;
+	else if (tp == BCDUMP_KTAB_NUM) {
+		o->u32.lo = bcread_uleb128_num(ls);
+		o->u32.hi = bcread_uleb128_num(ls);
 	}
-	else
-	{
-		result = (double *)~v4;
-		*((_DWORD *)v21 + 1) = (uint32_t)result;
+	else {
+		lua_assert(tp <= BCDUMP_KTAB_TRUE);
+		setpriV(o, ~tp);
 	}
-	return result;
 }
 
 /* Read a template table. */
@@ -554,7 +609,9 @@ static GCtab *bcread_ktab(LexState *ls)
 {
 	MSize narray = bcread_uleb128(ls);
 	MSize nhash = bcread_uleb128(ls);
-	GCtab *t = lj_tab_new(ls->L, narray, hsize2hbits(nhash));
+	GCtab *t;
+	bcread_checktab(ls, narray, nhash);
+	t = lj_tab_new(ls->L, narray, hsize2hbits(nhash));
 	if (narray) {  /* Read array entries. */
 		MSize i;
 		TValue *o = tvref(t->array);
@@ -596,15 +653,18 @@ static void bcread_kgc(LexState *ls, GCproto *pt, MSize sizekgc)
 			CTypeID id = tp == BCDUMP_KGC_COMPLEX ? CTID_COMPLEX_DOUBLE :
 				tp == BCDUMP_KGC_I64 ? CTID_INT64 : CTID_UINT64;
 			CTSize sz = tp == BCDUMP_KGC_COMPLEX ? 16 : 8;
-			GCcdata *cd = lj_cdata_new_(ls->L, id, sz);
+			GCcdata *cd;
+			if (!(bcread_flags(ls) & BCDUMP_F_FFI))  /* No ctype state. */
+				bcread_error(ls, LJ_ERR_BCBAD);
+			cd = lj_cdata_new_(ls->L, id, sz);
 			TValue *p = (TValue *)cdataptr(cd);
 			setgcref(*kr, obj2gco(cd));
-			p[0].u32.lo = bcread_uleb128(ls);
-			p[0].u32.hi = bcread_uleb128(ls);
+			p[0].u32.lo = bcread_uleb128_num(ls);
+			p[0].u32.hi = bcread_uleb128_num(ls);
 			if (tp == BCDUMP_KGC_COMPLEX)
 			{
-				p[1].u32.lo = bcread_uleb128(ls);
-				p[1].u32.hi = bcread_uleb128(ls);
+				p[1].u32.lo = bcread_uleb128_num(ls);
+				p[1].u32.hi = bcread_uleb128_num(ls);
 			}
 #endif
 		}
@@ -621,17 +681,94 @@ static void bcread_kgc(LexState *ls, GCproto *pt, MSize sizekgc)
 }
 
 
+/* Read an obfuscated template table. The hash size may come first. */
+static GCtab *bcread_ktab_mod(LexState *ls)
+{
+	MSize n1 = bcread_uleb128(ls);
+	MSize n2 = bcread_uleb128(ls);
+	MSize narray = bcobf.hashfirst ? n2 : n1;
+	MSize nhash = bcobf.hashfirst ? n1 : n2;
+	GCtab *t;
+	bcread_checktab(ls, narray, nhash);
+	t = lj_tab_new(ls->L, narray, hsize2hbits(nhash));
+	if (narray) {  /* Read array entries. */
+		MSize i;
+		TValue *o = tvref(t->array);
+		for (i = 0; i < narray; i++, o++)
+			bcread_ktabk_mod(ls, o);
+	}
+	if (nhash) {  /* Read hash entries. */
+		MSize i;
+		for (i = 0; i < nhash; i++) {
+			TValue key;
+			bcread_ktabk_mod(ls, &key);
+			lua_assert(!tvisnil(&key));
+			bcread_ktabk_mod(ls, lj_tab_set(ls->L, t, &key));
+		}
+	}
+	return t;
+}
+
+/* Read obfuscated GC constants of a prototype. */
+static void bcread_kgc_mod(LexState *ls, GCproto *pt, MSize sizekgc)
+{
+	MSize i;
+	GCRef *kr = mref(pt->k, GCRef) - (ptrdiff_t)sizekgc;
+	for (i = 0; i < sizekgc; i++, kr++) {
+		MSize tp = bcobf_kgctype(bcread_uleb128(ls));
+		if (tp == BCOBF_KGC_BAD) {
+			bcread_error(ls, LJ_ERR_BCBAD);
+		}
+		else if (tp >= BCDUMP_KGC_STR) {
+			setgcref(*kr, obj2gco(bcread_kstr_mod(ls, tp - BCDUMP_KGC_STR)));
+		}
+		else if (tp == BCDUMP_KGC_TAB) {
+			setgcref(*kr, obj2gco(bcread_ktab_mod(ls)));
+#if LJ_HASFFI
+		}
+		else if (tp != BCDUMP_KGC_CHILD) {
+			CTypeID id = tp == BCDUMP_KGC_COMPLEX ? CTID_COMPLEX_DOUBLE :
+				tp == BCDUMP_KGC_I64 ? CTID_INT64 : CTID_UINT64;
+			CTSize sz = tp == BCDUMP_KGC_COMPLEX ? 16 : 8;
+			GCcdata *cd;
+			if (!(bcread_flags(ls) & BCDUMP_F_FFI))  /* No ctype state. */
+				bcread_error(ls, LJ_ERR_BCBAD);
+			cd = lj_cdata_new_(ls->L, id, sz);
+			TValue *p = (TValue *)cdataptr(cd);
+			setgcref(*kr, obj2gco(cd));
+			p[0].u32.lo = bcread_uleb128_num(ls);
+			p[0].u32.hi = bcread_uleb128_num(ls);
+			if (tp == BCDUMP_KGC_COMPLEX) {
+				p[1].u32.lo = bcread_uleb128_num(ls);
+				p[1].u32.hi = bcread_uleb128_num(ls);
+			}
+#endif
+		}
+		else {
+			lua_State *L = ls->L;
+			lua_assert(tp == BCDUMP_KGC_CHILD);
+			if (L->top <= bcread_oldtop(L, ls))  /* Stack underflow? */
+				bcread_error(ls, LJ_ERR_BCBAD);
+			L->top--;
+			setgcref(*kr, obj2gco(protoV(L->top)));
+		}
+	}
+}
+
 /* Read number constants of a prototype. */
 static void bcread_knum(LexState *ls, GCproto *pt, MSize sizekn)
 {
 	MSize i;
 	TValue *o = mref(pt->k, TValue);
 	for (i = 0; i < sizekn; i++, o++) {
-		int isnum = (ls->p[0] & 1);
-		uint32_t lo = bcread_uleb128_33(ls);
+		int isnum;
+		uint32_t lo;
+		bcread_check(ls, 1);
+		isnum = (ls->p[0] & 1);
+		lo = bcread_uleb128_33(ls);
 		if (isnum) {
 			o->u32.lo = lo;
-			o->u32.hi = bcread_uleb128(ls);
+			o->u32.hi = bcread_uleb128_num(ls);
 		}
 		else {
 			setintV(o, lo);
@@ -654,6 +791,30 @@ static void bcread_bytecode(LexState *ls, GCproto *pt, MSize sizebc)
 	}
 }
 
+/* Read obfuscated bytecode instructions.
+** Each instruction has its opcode permuted through the profile's opmap and
+** its operand bytes XORed with a key and the low byte of the instruction
+** index (A inverted and B XORed with the index in the built-in profile).
+*/
+static void bcread_bytecode_mod(LexState *ls, GCproto *pt, MSize sizebc)
+{
+	BCIns *bc = proto_bc(pt);
+	MSize i;
+	bc[0] = BCINS_AD((pt->flags & PROTO_VARARG) ? BC_FUNCV : BC_FUNCF,
+		pt->framesize, 0);
+	bcread_block(ls, bc + 1, (sizebc - 1)*(MSize)sizeof(BCIns));
+	/* Swap bytecode instructions if the endianess differs. */
+	if (bcread_swap(ls)) {
+		for (i = 1; i < sizebc; i++) bc[i] = lj_bswap(bc[i]);
+	}
+	for (i = 1; i < sizebc; i++) {
+		BCIns ins = bc[i];
+		if (LJ_UNLIKELY(bc_op(ins) >= BC__MAX))
+			bcread_error(ls, LJ_ERR_BCBAD);
+		bc[i] = (BCIns)bcobf.opmap[bc_op(ins)] | ((ins ^ bcobf_inskey(i - 1)) & 0xffffff00u);
+	}
+}
+
 /* Read upvalue refs. */
 static void bcread_uv(LexState *ls, GCproto *pt, MSize sizeuv)
 {
@@ -679,6 +840,7 @@ GCproto *lj_bcread_proto(LexState *ls)
 	BCLine firstline = 0, numline = 0;
 
 	/* Read prototype header. */
+	bcread_sec(ls) = BCREAD_SEC_HEADER;
 	flags = bcread_byte(ls);
 	numparams = bcread_byte(ls);
 	framesize = bcread_byte(ls);
@@ -693,6 +855,7 @@ GCproto *lj_bcread_proto(LexState *ls)
 			numline = bcread_uleb128(ls);
 		}
 	}
+	bcread_checksizes(ls, sizebc, sizeuv, sizekgc, sizekn, sizedbg);
 
 	/* Calculate total size of prototype including all colocated arrays. */
 	sizept = (MSize)sizeof(GCproto) +
@@ -723,12 +886,16 @@ GCproto *lj_bcread_proto(LexState *ls)
 	*(uint32_t *)((char *)pt + ofsk - sizeof(GCRef)*(sizekgc + 1)) = 0;
 
 	/* Read bytecode instructions and upvalue refs. */
+	bcread_sec(ls) = BCREAD_SEC_BC;
 	bcread_bytecode(ls, pt, sizebc);
+	bcread_sec(ls) = BCREAD_SEC_UV;
 	bcread_uv(ls, pt, sizeuv);
 
 	/* Read constants. */
+	bcread_sec(ls) = BCREAD_SEC_KGC;
 	bcread_kgc(ls, pt, sizekgc);
 	pt->sizekgc = sizekgc;
+	bcread_sec(ls) = BCREAD_SEC_KNUM;
 	bcread_knum(ls, pt, sizekn);
 
 	/* Read and initialize debug info. */
@@ -738,6 +905,7 @@ GCproto *lj_bcread_proto(LexState *ls)
 		MSize sizeli = (sizebc - 1) << (numline < 256 ? 0 : numline < 65536 ? 1 : 2);
 		setmref(pt->lineinfo, (char *)pt + ofsdbg);
 		setmref(pt->uvinfo, (char *)pt + ofsdbg + sizeli);
+		bcread_sec(ls) = BCREAD_SEC_DBG;
 		bcread_dbg(ls, pt, sizedbg);
 		setmref(pt->varinfo, bcread_varinfo(pt));
 	}
@@ -749,609 +917,86 @@ GCproto *lj_bcread_proto(LexState *ls)
 	return pt;
 }
 
-///* Read a prototype. */
-int lj_bcread_proto_mod(int ls)
-{
-	char *ls_p; // eax
-	char v2; // cl
-	char v3; // cl
-	char v4; // cl
-	unsigned __int8 v5; // cl
-	unsigned int ofsk; // esi
-	int pt; // eax
-	int pt_; // edx
-	int v9; // edx
-	char *v10; // esi
-	int v11; // eax
-	int v12; // edi
-	char v13; // cl
-	int v14; // edx
-	int v15; // edi
-	unsigned __int8 *v16; // esi
-	unsigned __int8 v17; // al
-	char *v18; // esi
-	unsigned __int8 v19; // cl
-	unsigned __int8 v20; // al
-	signed int v21; // ecx
-	unsigned int tp; // eax
-	__m128i *v23; // esi
-	size_t v24; // ecx
-	unsigned int v25; // edi
-	unsigned int v26; // eax
-	unsigned int v28; // ecx
-	__m128i v29; // xmm0
-	__m128i v30; // xmm1
-	int v31; // edx
-	int result; // eax
-	signed int v33; // ecx
-	int v34; // edi
-	char v35; // dl
-	__int16 v36; // si
-	int v37; // edi
-	int v38; // eax
-	unsigned int v39; // edx
-	int v40; // eax
-	unsigned int v41; // edx
-	int v42; // eax
-	int v43; // eax
-	unsigned int v44; // edi
-	double *v45; // esi
-	double *v46; // edx
-	unsigned int v47; // edi
-	double *v48; // eax
-	int v49; // esi
-	int v50; // ecx
-	int v51; // edx
-	unsigned int v52; // esi
-	int v53; // ecx
-	_BYTE *v54; // edx
-	char *v55; // eax
-	unsigned int v56; // edi
-	int v57; // ecx
-	signed int v58; // esi
-	unsigned int v59; // ecx
-	int v60; // eax
-	unsigned int v61; // edi
-	const __m128i *v64; // esi
-	__m128i v65; // xmm1
-	unsigned int v66; // esi
-	int v67; // edi
-	int v68; // ecx
-	unsigned int v69; // eax
-	char v70; // cl
-	__int16 v71; // cx
-	__int16 v72; // si
-	char v73; // cl
-	unsigned int sizebc; // [esp+14h] [ebp-58h]
-	char v87; // [esp+14h] [ebp-58h]
-	int v88; // [esp+14h] [ebp-58h]
-	__m128i *v89; // [esp+14h] [ebp-58h]
-	char **var54; // [esp+18h] [ebp-54h]
-	unsigned int sizekgc; // [esp+1Ch] [ebp-50h]
-	unsigned int sizekn; // [esp+20h] [ebp-4Ch]
-	int v91; // [esp+20h] [ebp-4Ch]
-	unsigned int v92; // [esp+24h] [ebp-48h]
-	int v93; // [esp+24h] [ebp-48h]
-	_DWORD *t; // [esp+24h] [ebp-48h]
-	unsigned int v95; // [esp+24h] [ebp-48h]
-	unsigned __int8 sizeuv; // [esp+28h] [ebp-44h]
-	int v99; // [esp+28h] [ebp-44h]
-	int v100; // [esp+28h] [ebp-44h]
-	unsigned int v101; // [esp+28h] [ebp-44h]
-	char v102; // [esp+28h] [ebp-44h]
-	size_t sizeuv_2; // [esp+2Ch] [ebp-40h]
-	unsigned int v104; // [esp+2Ch] [ebp-40h]
-	int pt__; // [esp+30h] [ebp-3Ch]
-	unsigned int var38; // [esp+34h] [ebp-38h]
-	char framesize; // [esp+38h] [ebp-34h]
-	char numparams; // [esp+3Eh] [ebp-2Eh]
-	char flags; // [esp+3Fh] [ebp-2Dh]
-	double key[4]; // [esp+48h] [ebp-24h]
-	__m128i v27;
-
-
-	ls_p = *(char **)(ls + 24);
-	*(_DWORD *)(ls + 24) = (uint32_t)(ls_p + 1);
-	v2 = *ls_p;
-	*(_DWORD *)(ls + 24) = (uint32_t)(ls_p + 2);
-	framesize = v2;
-	v3 = ls_p[1] ^ v2;
-	*(_DWORD *)(ls + 24) = (uint32_t)(ls_p + 3);
-	flags = v3;
-	v4 = ls_p[2] ^ v3;
-	*(_DWORD *)(ls + 24) = (uint32_t)(ls_p + 4);
-	numparams = v4;
-	v5 = ls_p[3] ^ v4;
-	sizeuv_2 = v5;
-	sizeuv = v5;
-	var54 = (char **)(ls + 24);
-	sizekn = lj_buf_ruleb128((const char **)(ls + 24));
-	sizekgc = lj_buf_ruleb128((const char **)(ls + 24));
-	v92 = lj_buf_ruleb128((const char **)(ls + 24));
-	sizebc = v92 + 1;
-	if (!(*(_BYTE *)(ls + 108) & 2) && lj_buf_ruleb128((const char **)var54))
-	{
-		*(_DWORD *)(ls + 24) += 4;
-		lj_buf_ruleb128((const char **)var54);
-		lj_buf_ruleb128((const char **)var54);
-		lj_buf_ruleb128((const char **)var54);
-		lj_buf_ruleb128((const char **)var54);
-		lj_buf_ruleb128((const char **)var54);
-		bcread_error_mod((lua_State*)*(_DWORD *)(ls + 4), *(const char **)(ls + 80));
-	}
-	ofsk = (4 * (sizebc + sizekgc + 18) + 7) & 0xFFFFFFF8;// sizept = (MSize)sizeof(GCproto) + sizebc*(MSize)sizeof(BCIns) + sizekgc*(MSize)sizeof(GCRef);
-														  //       sizept = (sizept + (MSize)sizeof(TValue)-1) & ~((MSize)sizeof(TValue)-1);
-	pt = (int)lj_mem_newgco(
-		(lua_State*)*(_DWORD *)(ls + 4),
-		ofsk + 8 * sizekn + ((2 * sizeuv_2 + 2) & 0x3FC));   // ˲ lua_State *L  GCSize sizeλ
-	*(_BYTE *)(pt + 5) = 7;                       // pt->gct
-	pt_ = pt;
-	pt__ = pt;
-	*(_DWORD *)(pt + 8) = sizebc;
-	*(_DWORD *)(pt + 44) = ofsk + 8 * sizekn + ((2 * sizeuv_2 + 2) & 0x3FC);// pt->sizept
-	*(_DWORD *)(pt + 20) = 0;                     // pt->sizekgc = 0;
-	*(_BYTE *)(pt + 6) = framesize;
-	*(_DWORD *)(pt + 36) = sizekn;
-	*(_DWORD *)(pt + 40) = 0;                      // pt->trace = 0;  ѸΪ4ֽ޷
-	*(_DWORD *)(pt + 28) = flags;				// ѸΪ4ֽ޷
-	*(_BYTE *)(pt + 7) = numparams;
-	*(_DWORD *)(pt + 16) = sizeuv;				// ѸΪ4ֽ޷
-	*(_DWORD *)(pt_ + 32) = pt_ + ofsk;           // pt->k
-	*(_DWORD *)(pt_ + 24) = pt_ + ofsk + 8 * sizekn;// pt->uv
-	*(_DWORD *)(pt + 48) = *(_DWORD *)(ls + 76);  // chunkname
-	*(_DWORD *)(pt + ofsk - (4 * sizekgc + 4)) = 0;// Close potentially uninitialized gap between bc and kgc.
-	*(_DWORD *)(pt_ + 72) = ((*(_BYTE *)(pt_ + 28) & 2u) < 1 ? 90 : 93) | (*(unsigned __int8 *)(pt_ + 6) << 8);// bcread_bytecode_mod() begin
-	v9 = 4 * v92;
-	v10 = *(char **)(ls + 24);
-	v11 = pt + 76;
-	var38 = 4 * v92;
-	v12 = v11;
-	*(_DWORD *)(ls + 24) = (uint32_t)&v10[4 * v92];
-	if (4 * v92 >= 8)
-	{
-		if (v11 & 1)
-		{
-			v70 = *v10++;
-			*(_BYTE *)(pt__ + 76) = v70;
-			v12 = pt__ + 77;
-			var38 = v9 - 1;
-		}
-		if (v12 & 2)
-		{
-			v71 = *(_WORD *)v10;
-			v12 += 2;
-			v10 += 2;
-			*(_WORD *)(v12 - 2) = v71;
-			var38 -= 2;
-		}
-		if (v12 & 4)
-		{
-			v53 = *(_DWORD *)v10;
-			v12 += 4;
-			v10 += 4;
-			*(_DWORD *)(v12 - 4) = v53;
-			var38 -= 4;
-		}
-	}
-	qmemcpy((void *)v12, v10, var38);
-	if (*(_BYTE *)(ls + 108) & 1 && sizebc > 1)
-	{
-		v50 = pt__;
-		v51 = pt__ + v9;
-		do
-		{
-			v52 = *(_DWORD *)(v50 + 76);
-			v50 += 4;
-			*(_DWORD *)(v50 + 72) = _byteswap_ulong(v52);
-		} while (v50 != v51);
-	}
-	else if (!v92)
-	{
-		goto LABEL_8;
-	}
-	v13 = 0;
-	v14 = 0;
-	do
-	{
-		*(_BYTE *)(v11 + 4 * v14 + 3) ^= v13++;
-		*(_BYTE *)(v11 + 4 * v14 + 1) = ~*(_BYTE *)(v11 + 4 * v14 + 1);
-		uint8_t obf_op = *(_BYTE *)(v11 + 4 * v14);
-		*(_BYTE *)(v11 + 4 * v14) = op_map[obf_op];
-		++v14;
-	} while (v14 != v92);
-LABEL_8:                                        // bcread_uv() begin
-	if (!sizeuv)
-		goto LABEL_9;
-	v89 = *(__m128i **)(pt__ + 24);
-	v54 = *(_BYTE **)(pt__ + 24);
-	v55 = *(char **)(ls + 24);
-	v56 = 2 * sizeuv_2;
-	*(_DWORD *)(ls + 24) = (uint32_t)&v55[2 * sizeuv_2];
-	v57 = (int)v54;
-	if (2 * sizeuv_2 >= 8)
-	{
-		if ((unsigned __int8)v54 & 1)
-		{
-			v73 = *v55;
-			--v56;
-			++v55;
-			*v54 = v73;
-			v57 = (int)(v54 + 1);
-		}
-		if (v57 & 2)
-		{
-			v72 = *(_WORD *)v55;
-			v57 += 2;
-			v55 += 2;
-			v56 -= 2;
-			*(_WORD *)(v57 - 2) = v72;
-		}
-		if (v56 >= 8)
-		{
-			v95 = v56 & 0xFFFFFFF8;
-			v66 = 0;
-			v102 = v56;
-			do
-			{
-				v67 = *(_DWORD *)&v55[v66];
-				*(_DWORD *)(v57 + v66 + 4) = *(_DWORD *)&v55[v66 + 4];
-				*(_DWORD *)(v57 + v66) = v67;
-				v66 += 8;
-			} while (v66 < v95);
-			LOBYTE(v56) = v102;
-			v57 += v66;
-			v55 += v66;
-		}
-	}
-	v58 = 0;
-	if (v56 & 4)
-	{
-		*(_DWORD *)v57 = *(_DWORD *)v55;
-		v58 = 4;
-		if (!(v56 & 2))
-		{
-		LABEL_78:
-			if (!(v56 & 1))
-				goto LABEL_79;
-			goto LABEL_86;
-		}
+/* Read an obfuscated prototype, laid out as the active profile says.
+** In the built-in profile the header bytes form an XOR chain, sizekn
+** precedes sizekgc and the number constants precede the GC constants.
+** Debug info is not supported.
+*/
+GCproto *lj_bcread_proto_mod(LexState *ls)
+{
+	GCproto *pt;
+	MSize framesize, numparams, flags, sizeuv, sizekgc, sizekn, sizebc, sizept;
+	MSize ofsk, ofsuv, hdr[4], n1, n2;
+
+	/* Read prototype header. */
+	bcread_sec(ls) = BCREAD_SEC_HEADER;
+	bcobf_header(bcread_mem(ls, 4), hdr);
+	framesize = hdr[BCOBF_FRAMESIZE];
+	flags = hdr[BCOBF_FLAGS];
+	numparams = hdr[BCOBF_NUMPARAMS];
+	sizeuv = hdr[BCOBF_SIZEUV];
+	n1 = bcread_uleb128(ls);
+	n2 = bcread_uleb128(ls);
+	sizekn = bcobf.knsizefirst ? n1 : n2;
+	sizekgc = bcobf.knsizefirst ? n2 : n1;
+	sizebc = bcread_uleb128(ls) + 1;
+	if (!(bcread_flags(ls) & BCDUMP_F_STRIP) && bcread_uleb128(ls) != 0)
+		bcread_error(ls, LJ_ERR_BCBAD);
+	bcread_checksizes(ls, sizebc, sizeuv, sizekgc, sizekn, 0);
+
+	/* Calculate total size of prototype including all colocated arrays. */
+	sizept = (MSize)sizeof(GCproto) +
+		sizebc*(MSize)sizeof(BCIns) +
+		sizekgc*(MSize)sizeof(GCRef);
+	sizept = (sizept + (MSize)sizeof(TValue) - 1) & ~((MSize)sizeof(TValue) - 1);
+	ofsk = sizept; sizept += sizekn*(MSize)sizeof(TValue);
+	ofsuv = sizept; sizept += ((sizeuv + 1)&~1) * 2;
+
+	/* Allocate prototype object and initialize its fields. */
+	pt = (GCproto *)lj_mem_newgco(ls->L, (MSize)sizept);
+	pt->gct = ~LJ_TPROTO;
+	pt->numparams = (uint8_t)numparams;
+	pt->framesize = (uint8_t)framesize;
+	pt->sizebc = sizebc;
+	setmref(pt->k, (char *)pt + ofsk);
+	setmref(pt->uv, (char *)pt + ofsuv);
+	pt->sizekgc = 0;  /* Set to zero until fully initialized. */
+	pt->sizekn = sizekn;
+	pt->sizept = sizept;
+	pt->sizeuv = sizeuv;
+	pt->flags = flags;
+	pt->trace = 0;
+	setgcref(pt->chunkname, obj2gco(ls->chunkname));
+
+	/* Close potentially uninitialized gap between bc and kgc. */
+	*(uint32_t *)((char *)pt + ofsk - sizeof(GCRef)*(sizekgc + 1)) = 0;
+
+	/* Read bytecode instructions and upvalue refs. */
+	bcread_sec(ls) = BCREAD_SEC_BC;
+	bcread_bytecode_mod(ls, pt, sizebc);
+	bcread_sec(ls) = BCREAD_SEC_UV;
+	bcread_uv(ls, pt, sizeuv);
+
+	/* Read constants. */
+	if (bcobf.knfirst) {
+		bcread_sec(ls) = BCREAD_SEC_KNUM;
+		bcread_knum(ls, pt, sizekn);
 	}
-	else if (!(v56 & 2))
-	{
-		goto LABEL_78;
-	}
-	*(_WORD *)(v57 + v58) = *(_WORD *)&v55[v58];
-	v58 += 2;
-	if (!(v56 & 1))
-	{
-	LABEL_79:
-		if (!(*(_BYTE *)(ls + 108) & 1))
-			goto LABEL_9;
-		goto LABEL_80;
-	}
-LABEL_86:
-	*(_BYTE *)(v57 + v58) = v55[v58];
-	if (!(*(_BYTE *)(ls + 108) & 1))
-		goto LABEL_9;
-LABEL_80:
-	v59 = ((sizeuv_2 - 8) >> 3) + 1;
-	v60 = 8 * v59;
-	if (sizeuv_2 - 1 <= 6)
-	{
-		v60 = 0;
-	}
-	else
-	{
-		v61 = 0;
-		v64 = v89;
-		do
-		{
-			v65 = _mm_loadu_si128(v64);
-			++v61;
-			++v64;
-			_mm_storeu_si128(
-				(__m128i *)&v64[-1],
-				_mm_or_si128(
-					_mm_or_si128(
-						_mm_shuffle_epi8(_mm_slli_epi32(_mm_unpackhi_epi16(v65, _mm_setzero_si128()), 8u), LD128(xmmword_943B0)),
-						_mm_shuffle_epi8(_mm_slli_epi32(_mm_unpacklo_epi16(v65, _mm_setzero_si128()), 8u), LD128(xmmword_943A0))),
-					_mm_srli_epi16(v65, 8u)));
-		} while (v59 > v61);
-		if (sizeuv_2 == v60)
-			goto LABEL_9;
-	}
-	v89[v60 / 8u].m128i_i16[0] = (v89[v60 / 8u].m128i_i16[0] << 8) | ((unsigned __int16)v89[v60 / 8u].m128i_i16[0] >> 8);
-	if (sizeuv_2 > (size_t)(v60 + 1))
-	{
-		*((_WORD *)v89->m128i_i32 + v60 + 1) = (*((_WORD *)v89->m128i_i32 + v60 + 1) << 8) | (*((_WORD *)v89->m128i_i32
-			+ v60
-			+ 1) >> 8);
-		if (sizeuv_2 > (size_t)(v60 + 2))
-		{
-			*((_WORD *)v89->m128i_i32 + v60 + 2) = (*((_WORD *)v89->m128i_i32 + v60 + 2) << 8) | (*((_WORD *)v89->m128i_i32
-				+ v60
-				+ 2) >> 8);
-			if (sizeuv_2 > (size_t)(v60 + 3))
-			{
-				*((_WORD *)v89->m128i_i32 + v60 + 3) = (*((_WORD *)v89->m128i_i32 + v60 + 3) << 8) | (*((_WORD *)v89->m128i_i32
-					+ v60
-					+ 3) >> 8);
-				if (sizeuv_2 > (size_t)(v60 + 4))
-				{
-					*((_WORD *)v89->m128i_i32 + v60 + 4) = (*((_WORD *)v89->m128i_i32 + v60 + 4) << 8) | (*((_WORD *)v89->m128i_i32
-						+ v60
-						+ 4) >> 8);
-					v68 = v60 + 5;
-					if (sizeuv_2 > (size_t)(v60 + 5))
-					{
-						v69 = v60 + 6;
-						*((_WORD *)v89->m128i_i32 + v68) = (*((_WORD *)v89->m128i_i32 + v68) << 8) | (*((_WORD *)v89->m128i_i32 + v68) >> 8);
-						if (sizeuv_2 > v69)
-							*((_WORD *)v89->m128i_i32 + v69) = (*((_WORD *)v89->m128i_i32 + v69) << 8) | (*((_WORD *)v89->m128i_i32
-								+ v69) >> 8);
-					}
-				}
-			}
-		}
+	bcread_sec(ls) = BCREAD_SEC_KGC;
+	bcread_kgc_mod(ls, pt, sizekgc);
+	pt->sizekgc = sizekgc;
+	if (!bcobf.knfirst) {
+		bcread_sec(ls) = BCREAD_SEC_KNUM;
+		bcread_knum(ls, pt, sizekn);
 	}
-LABEL_9:                                        // bcread_knum() begin
-	v15 = 0;
-	v93 = *(_DWORD *)(pt__ + 32);
-	if (sizekn)
-	{
-		do
-		{
-			while (1)
-			{
-				v16 = *(unsigned __int8 **)(ls + 24);
-				v17 = *v16;
-				v18 = (char *)(v16 + 1);
-				v19 = v17;
-				v20 = v17 >> 1;
-				v87 = v19 & 1;
-				v21 = v20;
-				if (v20 > 0x3Fu)
-				{
-					v33 = -1;
-					v100 = v15;
-					v34 = v20 & 0x3F;
-					do
-					{
-						v35 = *v18;
-						v33 += 7;
-						++v18;
-						v34 |= (v35 & 0x7F) << v33;
-					} while (v35 < 0);
-					v21 = v34;
-					v15 = v100;
-				}
-				*(_DWORD *)(ls + 24) = (uint32_t)v18;
-				if (v87)
-					break;
-				*(double *)(v93 + 8 * v15++) = (double)v21;
-				if (v15 == sizekn)
-					goto LABEL_15;
-			}
-			*(_DWORD *)(v93 + 8 * v15) = v21;
-			*(_DWORD *)(v93 + 8 * v15++ + 4) = lj_buf_ruleb128((const char **)var54);
-		} while (v15 != sizekn);
-	LABEL_15:
-		v93 = *(_DWORD *)(pt__ + 32);
-	}
-	v91 = v93 - 4 * sizekgc;                      // bcread_kgc() begin
-	v88 = 0;
-	if (sizekgc)
-	{
-		while (1)
-		{
-			while (1)
-			{
-				tp = lj_buf_ruleb128((const char **)var54);
-				if (tp <= 4)
-					break;
-				v23 = *(__m128i **)(ls + 24);
-				v24 = tp - 5;
-				*(_DWORD *)(ls + 24) = (uint32_t)((char *)v23 + tp - 5);
-				if (tp != 5)
-				{
-					v25 = ((tp - 21) >> 4) + 1;
-					if (tp - 6 <= 0xE)
-					{
-						v31 = 0;
-					LABEL_37:
-						v23[v31 / 0x10u].m128i_i8[0] = ~(v23[v31 / 0x10u].m128i_i8[0] ^ v31);
-						if (v24 > (size_t)(v31 + 1))
-						{
-							v23[v31 / 0x10u].m128i_i8[1] = ~(v23[v31 / 0x10u].m128i_i8[1] ^ (v31 + 1));
-							if ((size_t)(v31 + 2) < v24)
-							{
-								v23[v31 / 0x10u].m128i_i8[2] = ~(v23[v31 / 0x10u].m128i_i8[2] ^ (v31 + 2));
-								if (v24 > (size_t)(v31 + 3))
-								{
-									v23[v31 / 0x10u].m128i_i8[3] = ~(v23[v31 / 0x10u].m128i_i8[3] ^ (v31 + 3));
-									if (v24 > (size_t)(v31 + 4))
-									{
-										v23[v31 / 0x10u].m128i_i8[4] = ~(v23[v31 / 0x10u].m128i_i8[4] ^ (v31 + 4));
-										if (v24 > (size_t)(v31 + 5))
-										{
-											v23[v31 / 0x10u].m128i_i8[5] = ~(v23[v31 / 0x10u].m128i_i8[5] ^ (v31 + 5));
-											if (v24 > (size_t)(v31 + 6))
-											{
-												v23[v31 / 0x10u].m128i_i8[6] = ~(v23[v31 / 0x10u].m128i_i8[6] ^ (v31 + 6));
-												if (v24 > (size_t)(v31 + 7))
-												{
-													v23[v31 / 0x10u].m128i_i8[7] = ~(v23[v31 / 0x10u].m128i_i8[7] ^ (v31 + 7));
-													if (v24 > (size_t)(v31 + 8))
-													{
-														v23[v31 / 0x10u].m128i_i8[8] = ~(v23[v31 / 0x10u].m128i_i8[8] ^ (v31 + 8));
-														if (v24 > (size_t)(v31 + 9))
-														{
-															v23[v31 / 0x10u].m128i_i8[9] = ~(v23[v31 / 0x10u].m128i_i8[9] ^ (v31 + 9));
-															if (v24 > (size_t)(v31 + 10))
-															{
-																v23[v31 / 0x10u].m128i_i8[10] = ~(v23[v31 / 0x10u].m128i_i8[10] ^ (v31 + 10));
-																if (v24 > (size_t)(v31 + 11))
-																{
-																	v23[v31 / 0x10u].m128i_i8[11] = ~(v23[v31 / 0x10u].m128i_i8[11] ^ (v31 + 11));
-																	if (v24 > (size_t)(v31 + 12))
-																	{
-																		v23[v31 / 0x10u].m128i_i8[12] = ~(v23[v31 / 0x10u].m128i_i8[12] ^ (v31 + 12));
-																		v40 = v31 + 13;
-																		if (v24 > (size_t)(v31 + 13))
-																		{
-																			v41 = v31 + 14;
-																			*((_BYTE *)v23->m128i_i32 + v40) = ~(*((_BYTE *)v23->m128i_i32 + v40) ^ v40);
-																			if (v24 > v41)
-																				*((_BYTE *)v23->m128i_i32 + v41) = ~(*((_BYTE *)v23->m128i_i32 + v41) ^ v41);
-																		}
-																	}
-																}
-															}
-														}
-													}
-												}
-											}
-										}
-									}
-								}
-							}
-						}
-						goto LABEL_23;
-					}
-					v99 = tp - 5;
-					v26 = 0;
-					v27 = LD128(xmmword_94560);
-					do
-					{
-						v28 = v26++;
-						v29 = _mm_and_si128(
-							_mm_or_si128(
-								_mm_shuffle_epi8(
-									_mm_add_epi32(LD128(xmmword_94580), v27),
-									LD128(xmmword_943B0)),
-								_mm_shuffle_epi8(v27, LD128(xmmword_943A0))),
-							LD128(xmmword_943C0));
-						v30 = _mm_or_si128(
-							_mm_shuffle_epi8(
-								_mm_add_epi32(LD128(xmmword_94320), v27),
-								LD128(xmmword_943B0)),
-							_mm_shuffle_epi8(
-								_mm_add_epi32(LD128(xmmword_94590), v27),
-								LD128(xmmword_943A0)));
-						v27 = _mm_add_epi32(v27, LD128(xmmword_94570));
-						_mm_storeu_si128(
-							&v23[v28],
-							_mm_xor_si128(
-								_mm_packus_epi16(v29, _mm_and_si128(v30, LD128(xmmword_943C0))),
-								_mm_xor_si128(_mm_loadu_si128(&v23[v28]), LD128(xmmword_945A0))));
-					} while (v26 < v25);
-					v24 = v99;
-					v31 = 16 * v25;
-					if (v99 != 16 * v25)
-						goto LABEL_37;
-				}
-			LABEL_23:
-				*(_DWORD *)(v91 + 4 * v88++) = (uint32_t)lj_str_new((lua_State*)*(_DWORD *)(ls + 4), (char*)v23, v24);
-				if (v88 == sizekgc)
-					goto LABEL_24;
-			}
-			if (tp != 1)
-			{
-				if (tp)
-				{
-					if (tp == 4)
-					{
-						v49 = (int)lj_mem_newgco((lua_State *)(ls + 4), 24);
-						*(_BYTE *)(v49 + 5) = 10;
-						*(_WORD *)(v49 + 6) = 16;
-						*(_DWORD *)(v91 + 4 * v88) = v49;
-						*(_DWORD *)(v49 + 8) = lj_buf_ruleb128((const char **)var54);
-						*(_DWORD *)(v49 + 12) = lj_buf_ruleb128((const char **)var54);
-						*(_DWORD *)(v49 + 16) = lj_buf_ruleb128((const char **)var54);
-						*(_DWORD *)(v49 + 20) = lj_buf_ruleb128((const char **)var54);
-					}
-					else
-					{
-						v36 = (tp != 2) + 11;
-						v37 = (int)lj_mem_newgco((lua_State *)(ls + 4), 16);
-						*(_WORD *)(v37 + 6) = v36;
-						*(_BYTE *)(v37 + 5) = 10;
-						*(_DWORD *)(v91 + 4 * v88) = v37;
-						*(_DWORD *)(v37 + 8) = lj_buf_ruleb128((const char **)var54);
-						*(_DWORD *)(v37 + 12) = lj_buf_ruleb128((const char **)var54);
-					}
-				}
-				else
-				{
-					v38 = *(_DWORD *)(ls + 4);
-					v39 = *(_DWORD *)(v38 + 20);
-					if (v39 <= *(_DWORD *)(ls + 72) + *(_DWORD *)(v38 + 28))
-						bcread_error_mod((lua_State*)v38, *(const char **)(ls + 80));
-					*(_DWORD *)(v38 + 20) = v39 - 8;
-					*(_DWORD *)(v91 + 4 * v88) = *(_DWORD *)(v39 - 8);
-				}
-				goto LABEL_32;
-			}
-			v101 = lj_buf_ruleb128((const char **)var54);            // bcread_ktab() begin
-			v104 = lj_buf_ruleb128((const char **)var54);
-			if (!v101)
-				break;
-			if (v101 == 1)
-			{
-				v43 = 1;
-			}
-			else
-			{
-				_BitScanReverse((unsigned int *)&v42, v101 - 1);
-				v43 = v42 + 1;
-			}
-			t = (uint32_t*)lj_tab_new((lua_State*)*(_DWORD *)(ls + 4), v104, v43);
-			if (v104)
-				goto LABEL_56;
-		LABEL_59:
-			v47 = 0;
-			do
-			{
-				bcread_ktabk_mod(ls, key);
-				++v47;
-				v48 = (double *)lj_tab_set((lua_State*)*(_DWORD *)(ls + 4), (GCtab*)t, (cTValue*)key);
-				bcread_ktabk_mod(ls, v48);
-			} while (v101 > v47);
-		LABEL_61:
-			*(_DWORD *)(v91 + 4 * v88) = (uint32_t)t;
-		LABEL_32:
-			if (++v88 == sizekgc)
-				goto LABEL_24;
-		}
-		t = (uint32_t*)lj_tab_new((lua_State*)*(_DWORD *)(ls + 4), v104, 0);
-		if (!v104)
-		{
-			*(_DWORD *)(v91 + 4 * v88) = (uint32_t)t;
-			goto LABEL_32;
-		}
-	LABEL_56:
-		v44 = 0;
-		v45 = (double *)t[2];
-		do
-		{
-			v46 = v45;
-			++v44;
-			++v45;
-			bcread_ktabk_mod(ls, v46);
-		} while (v104 > v44);                       // bcread_ktab() end
-		if (!v101)
-			goto LABEL_61;
-		goto LABEL_59;
-	}
-LABEL_24:
-	result = pt__;
-	*(_DWORD *)(pt__ + 52) = 0;
-	*(_DWORD *)(pt__ + 20) = sizekgc;
-	*(_DWORD *)(pt__ + 56) = 0;
-	*(_DWORD *)(pt__ + 60) = 0;
-	*(_DWORD *)(pt__ + 64) = 0;
-	*(_DWORD *)(pt__ + 68) = 0;
-	return result;
+
+	/* No debug info. */
+	pt->firstline = 0;
+	pt->numline = 0;
+	setmref(pt->lineinfo, NULL);
+	setmref(pt->uvinfo, NULL);
+	setmref(pt->varinfo, NULL);
+	return pt;
 }
 
 /* Read and check header of bytecode dump. */
@@ -1388,21 +1033,31 @@ static int bcread_header(LexState *ls)
 	return 1;  /* Ok. */
 	}
 
-/* Read a bytecode dump. */
-GCproto *lj_bcread(LexState *ls)
+static int bcprobe_proto(const uint8_t *p, MSize len, MSize dflags);
+
+typedef GCproto *(*BCReadProtoFn)(LexState *ls);
+
+/* Read all prototypes of a bytecode dump. Without a prototype reader the
+** layout is picked by probing the first prototype.
+*/
+static GCproto *bcread_dump(LexState *ls, BCReadProtoFn readproto)
 {
 	lua_State *L = ls->L;
 	lua_assert(ls->c == BCDUMP_HEAD1);
 	bcread_savetop(L, ls, L->top);
 	lj_buf_reset(&ls->sb);
+	/* The lexer has consumed the first byte of the input. */
+	bcread_pos(ls) = 1 + (BCLine)(ls->pe - ls->p);
+	bcread_sec(ls) = BCREAD_SEC_HEADER;
 	/* Check for a valid bytecode dump header. */
 	if (!bcread_header(ls))
 		bcread_error(ls, LJ_ERR_BCFMT);
 	for (;;) {  /* Process all prototypes in the bytecode dump. */
 		GCproto *pt;
 		MSize len;
-		const char *startp;
+		const char *startp, *pe;
 		/* Read length. */
+		bcread_sec(ls) = BCREAD_SEC_HEADER;
 		if (ls->p < ls->pe && ls->p[0] == 0) {  /* Shortcut EOF. */
 			ls->p++;
 			break;
@@ -1412,9 +1067,24 @@ GCproto *lj_bcread(LexState *ls)
 		if (!len) break;  /* EOF */
 		bcread_need(ls, len);
 		startp = ls->p;
-		pt = lj_bcread_proto(ls);
-		if (ls->p != startp + len)
+		/* Limit reads to this prototype's record. */
+		pe = ls->pe;
+		ls->pe = startp + len;
+		bcread_pos(ls) -= (BCLine)(pe - ls->pe);
+		if (!readproto) {
+			int kinds = bcprobe_proto((const uint8_t *)startp, len, bcread_flags(ls));
+			if (kinds & (1 << BCPROBE_OBFUSCATED))
+				readproto = lj_bcread_proto_mod;
+			else if (kinds & (1 << BCPROBE_STANDARD))
+				readproto = lj_bcread_proto;
+			else
+				bcread_error(ls, LJ_ERR_BCBAD);
+		}
+		pt = readproto(ls);
+		if (ls->p != ls->pe)
 			bcread_error(ls, LJ_ERR_BCBAD);
+		bcread_pos(ls) += (BCLine)(pe - ls->pe);
+		ls->pe = pe;
 		setprotoV(L, L->top, pt);
 		incr_top(L);
 	}
@@ -1427,39 +1097,776 @@ GCproto *lj_bcread(LexState *ls)
 }
 
 /* Read a bytecode dump. */
+GCproto *lj_bcread(LexState *ls)
+{
+	return bcread_dump(ls, lj_bcread_proto);
+}
+
+/* Read an obfuscated bytecode dump. */
 GCproto *lj_bcread_mod(LexState *ls)
 {
-	lua_State *L = ls->L;
-	lua_assert(ls->c == BCDUMP_HEAD1);
-	bcread_savetop(L, ls, L->top);
-	lj_buf_reset(&ls->sb);
-	/* Check for a valid bytecode dump header. */
-	if (!bcread_header(ls))
-		bcread_error(ls, LJ_ERR_BCFMT);
-	for (;;) {  /* Process all prototypes in the bytecode dump. */
-		GCproto *pt;
-		MSize len;
-		const char *startp;
-		/* Read length. */
-		if (ls->p < ls->pe && ls->p[0] == 0) {  /* Shortcut EOF. */
-			ls->p++;
-			break;
+	return bcread_dump(ls, lj_bcread_proto_mod);
+}
+
+/* Read a standard or obfuscated bytecode dump. */
+GCproto *lj_bcread_any_mod(LexState *ls)
+{
+	return bcread_dump(ls, NULL);
+}
+
+/* -- Direct transcoder --------------------------------------------------- */
+
+/* Context for the direct transcoder. */
+typedef struct BCTransCtx {
+	const uint8_t *p;	/* Current input position. */
+	const uint8_t *pe;	/* End of input (of the current prototype). */
+	uint8_t *q;		/* Current output position. */
+	MSize nproto;		/* Prototypes not yet claimed as children, or
+				** children seen when probing. */
+	MSize flags;		/* Flags of the last prototype. */
+	int err;		/* Set on malformed or truncated input. */
+} BCTransCtx;
+
+/* Take a block of input bytes. */
+static const uint8_t *bctrans_mem(BCTransCtx *ctx, size_t len)
+{
+	const uint8_t *p = ctx->p;
+	if (LJ_UNLIKELY((size_t)(ctx->pe - p) < len)) {
+		ctx->err = 1;
+		return NULL;
+	}
+	ctx->p = p + len;
+	return p;
+}
+
+/* Append a block of bytes to the output. */
+static LJ_AINLINE void bctrans_wmem(BCTransCtx *ctx, const uint8_t *p, size_t len)
+{
+	memcpy(ctx->q, p, len);
+	ctx->q += len;
+}
+
+/* Read a bounds-checked ULEB128 value. */
+static uint32_t bctrans_uleb128(BCTransCtx *ctx)
+{
+	const uint8_t *p = ctx->p;
+	uint32_t v = 0;
+	int sh = 0;
+	do {
+		if (LJ_UNLIKELY(p >= ctx->pe || sh > 28)) {
+			ctx->err = 1;
+			return 0;
 		}
-		bcread_want(ls, 5);
-		len = bcread_uleb128(ls);
+		v |= (uint32_t)(*p & 0x7f) << sh;
+		sh += 7;
+	} while (*p++ >= 0x80);
+	ctx->p = p;
+	return v;
+}
+
+/* Copy a ULEB128 value to the output unchanged and return it. */
+static uint32_t bctrans_copy_uleb128(BCTransCtx *ctx)
+{
+	const uint8_t *p = ctx->p;
+	uint32_t v = bctrans_uleb128(ctx);
+	bctrans_wmem(ctx, p, (size_t)(ctx->p - p));
+	return v;
+}
+
+/* Decode an obfuscated string constant into the output. */
+static void bctrans_kstr(BCTransCtx *ctx, MSize len)
+{
+	const uint8_t *p = bctrans_mem(ctx, len);
+	if (p) {
+		bcread_strdec_mod(ctx->q, p, len);
+		ctx->q += len;
+	}
+}
+
+/* Transcode a single constant key/value of a template table. */
+static void bctrans_ktabk(BCTransCtx *ctx)
+{
+	MSize tp = bctrans_copy_uleb128(ctx);
+	if (tp >= BCDUMP_KTAB_STR) {
+		bctrans_kstr(ctx, tp - BCDUMP_KTAB_STR);
+	} else if (tp == BCDUMP_KTAB_INT) {
+		bctrans_copy_uleb128(ctx);
+	} else if (tp == BCDUMP_KTAB_NUM) {
+		bctrans_copy_uleb128(ctx);
+		bctrans_copy_uleb128(ctx);
+	}
+}
+
+/* Transcode a template table, moving the array size back in front. */
+static void bctrans_ktab(BCTransCtx *ctx)
+{
+	const uint8_t *p1 = ctx->p, *p2;
+	MSize n1, n2, nhash, narray, i;
+	n1 = bctrans_uleb128(ctx);
+	p2 = ctx->p;
+	n2 = bctrans_uleb128(ctx);
+	if (bcobf.hashfirst) {
+		narray = n2; nhash = n1;
+		bctrans_wmem(ctx, p2, (size_t)(ctx->p - p2));
+		bctrans_wmem(ctx, p1, (size_t)(p2 - p1));
+	} else {
+		narray = n1; nhash = n2;
+		bctrans_wmem(ctx, p1, (size_t)(ctx->p - p1));
+	}
+	for (i = 0; i < narray && !ctx->err; i++)
+		bctrans_ktabk(ctx);
+	for (i = 0; i < nhash && !ctx->err; i++) {
+		bctrans_ktabk(ctx);
+		bctrans_ktabk(ctx);
+	}
+}
+
+/* Transcode the GC constants of a prototype. */
+static void bctrans_kgc(BCTransCtx *ctx, MSize sizekgc)
+{
+	MSize i;
+	for (i = 0; i < sizekgc && !ctx->err; i++) {
+		MSize tp = bcobf_kgctype(bctrans_uleb128(ctx));
+		if (ctx->err || tp == BCOBF_KGC_BAD) {
+			ctx->err = 1;
+			return;
+		}
+		/* Standard codes are never longer than the profile's codes. */
+		ctx->q = (uint8_t *)lj_strfmt_wuleb128((char *)ctx->q, tp);
+		if (tp >= BCDUMP_KGC_STR) {
+			bctrans_kstr(ctx, tp - BCDUMP_KGC_STR);
+		} else if (tp == BCDUMP_KGC_TAB) {
+			bctrans_ktab(ctx);
+		} else if (tp != BCDUMP_KGC_CHILD) {
+			MSize n = tp == BCDUMP_KGC_COMPLEX ? 4 : 2;
+			while (n--) bctrans_copy_uleb128(ctx);
+		} else if (!ctx->err) {
+			if (ctx->nproto == 0)  /* Child without a prototype. */
+				ctx->err = 1;
+			else
+				ctx->nproto--;
+		}
+	}
+}
+
+/* Skip a ULEB128 value of a number constant. */
+static LJ_AINLINE void bctrans_skip_uleb128(BCTransCtx *ctx)
+{
+#if LJ_LE
+	if (LJ_LIKELY(ctx->pe - ctx->p >= 8)) {
+		uint64_t w;
+		MSize n = bcread_uleb128_word(ctx->p, &w);
+		if (LJ_UNLIKELY(!n))
+			ctx->err = 1;
+		else
+			ctx->p += n;
+		return;
+	}
+#endif
+	bctrans_uleb128(ctx);
+}
+
+/* Skip the number constants of a prototype. */
+static void bctrans_knum(BCTransCtx *ctx, MSize sizekn)
+{
+	MSize i;
+	for (i = 0; i < sizekn && !ctx->err; i++) {
+		int isnum = ctx->p < ctx->pe && (ctx->p[0] & 1);
+		bctrans_skip_uleb128(ctx);
+		if (isnum) bctrans_skip_uleb128(ctx);
+	}
+}
+
+/* Transcode bytecode instructions. Works on bytes in dump order. */
+static void bctrans_bytecode(BCTransCtx *ctx, MSize nbc, int be)
+{
+	const uint8_t *p;
+	uint8_t *q = ctx->q;
+	int oop = be ? 3 : 0, oa = be ? 2 : 1, oc = be ? 1 : 2, ob = be ? 0 : 3;
+	MSize i;
+	if (nbc >= LJ_MAX_BCINS || !(p = bctrans_mem(ctx, (size_t)nbc*4))) {
+		ctx->err = 1;
+		return;
+	}
+	for (i = 0; i < nbc; i++, p += 4, q += 4) {
+		uint32_t key = bcobf_inskey(i);
+		if (LJ_UNLIKELY(p[oop] >= BC__MAX)) {
+			ctx->err = 1;
+			return;
+		}
+		q[oop] = bcobf.opmap[p[oop]];
+		q[oa] = (uint8_t)(p[oa] ^ (key >> 8));
+		q[oc] = (uint8_t)(p[oc] ^ (key >> 16));
+		q[ob] = (uint8_t)(p[ob] ^ (key >> 24));
+	}
+	ctx->q = q;
+}
+
+/* Transcode a prototype. */
+static void bctrans_proto(BCTransCtx *ctx, MSize dflags)
+{
+	const uint8_t *p, *p1, *p2, *pbc, *pe;
+	MSize flags, sizeuv, sizekn, sizekgc, nbc, n1, n2, hdr[4];
+
+	/* Undo the header XOR chain and restore the standard field order. */
+	if (!(p = bctrans_mem(ctx, 4))) return;
+	bcobf_header(p, hdr);
+	flags = hdr[BCOBF_FLAGS];
+	sizeuv = hdr[BCOBF_SIZEUV];
+	ctx->q[0] = (uint8_t)flags;
+	ctx->q[1] = (uint8_t)hdr[BCOBF_NUMPARAMS];
+	ctx->q[2] = (uint8_t)hdr[BCOBF_FRAMESIZE];
+	ctx->q[3] = (uint8_t)sizeuv;
+	ctx->q += 4;
+	p1 = ctx->p; n1 = bctrans_uleb128(ctx);
+	p2 = ctx->p; n2 = bctrans_uleb128(ctx);
+	pbc = ctx->p; nbc = bctrans_uleb128(ctx);
+	if (bcobf.knsizefirst) {
+		sizekn = n1; sizekgc = n2;
+		bctrans_wmem(ctx, p2, (size_t)(pbc - p2));
+		bctrans_wmem(ctx, p1, (size_t)(p2 - p1));
+	} else {
+		sizekgc = n1; sizekn = n2;
+		bctrans_wmem(ctx, p1, (size_t)(pbc - p1));
+	}
+	bctrans_wmem(ctx, pbc, (size_t)(ctx->p - pbc));
+	if (!(dflags & BCDUMP_F_STRIP) && bctrans_uleb128(ctx) != 0)
+		ctx->err = 1;  /* Debug info is not supported. */
+	if (ctx->err) return;
+
+	bctrans_bytecode(ctx, nbc, (dflags & BCDUMP_F_BE));
+	if ((p = bctrans_mem(ctx, (size_t)sizeuv*2)))
+		bctrans_wmem(ctx, p, (size_t)sizeuv*2);
+
+	/* Number constants may precede the GC constants here, but follow them
+	** in the standard format. Skip them first and copy them afterwards.
+	*/
+	if (bcobf.knfirst) {
+		p = ctx->p;
+		bctrans_knum(ctx, sizekn);
+		pe = ctx->p;
+		bctrans_kgc(ctx, sizekgc);
+	} else {
+		bctrans_kgc(ctx, sizekgc);
+		p = ctx->p;
+		bctrans_knum(ctx, sizekn);
+		pe = ctx->p;
+	}
+	bctrans_wmem(ctx, p, (size_t)(pe - p));
+
+	ctx->nproto++;
+	ctx->flags = flags;
+}
+
+/* Transcode the length-prefixed prototype record at ctx->p into a
+** standard record at ctx->q. pe is the end of the input. Returns 0 at the
+** end of the dump or with ctx->err set.
+*/
+static int bctrans_record(BCTransCtx *ctx, MSize dflags, const uint8_t *pe)
+{
+	const uint8_t *pl = ctx->p;
+	uint8_t *ql = ctx->q, *qp;
+	MSize len = bctrans_uleb128(ctx), nl = (MSize)(ctx->p - pl);
+	char tmp[5];
+	if (ctx->err || !len) return 0;  /* EOF */
+	if ((size_t)(pe - ctx->p) < len) {
+		ctx->err = 1;
+		return 0;
+	}
+	/* Transcode into the space of the input length prefix, which is at
+	** least as long as the prefix of the shorter output.
+	*/
+	qp = ctx->q = ql + nl;
+	ctx->pe = ctx->p + len;
+	bctrans_proto(ctx, dflags);
+	if (ctx->err || ctx->p != ctx->pe) {
+		ctx->err = 1;
+		return 0;
+	}
+	ctx->pe = pe;
+	len = (MSize)(ctx->q - qp);
+	nl = (MSize)(lj_strfmt_wuleb128(tmp, len) - tmp);
+	memcpy(ql, tmp, nl);
+	if (ql + nl != qp) memmove(ql + nl, qp, len);
+	ctx->q = ql + nl + len;
+	return 1;
+}
+
+/* Check the dump header and return the dump flags, or ~0 if malformed.
+** Leaves ctx->p after the chunk name.
+*/
+static MSize bctrans_header(BCTransCtx *ctx, const char *in, size_t n)
+{
+	const uint8_t *p;
+	MSize dflags;
+	ctx->p = (const uint8_t *)in;
+	ctx->pe = (const uint8_t *)in + n;
+	ctx->q = NULL;
+	ctx->nproto = 0;
+	ctx->flags = 0;
+	ctx->err = 0;
+	p = bctrans_mem(ctx, 4);
+	if (!p || p[0] != BCDUMP_HEAD1 || p[1] != BCDUMP_HEAD2 ||
+		p[2] != BCDUMP_HEAD3 || p[3] != BCDUMP_VERSION) return ~(MSize)0;
+	dflags = bctrans_uleb128(ctx);
+	if (ctx->err || (dflags & ~(BCDUMP_F_KNOWN)) != 0) return ~(MSize)0;
+	if (!(dflags & BCDUMP_F_STRIP))
+		bctrans_mem(ctx, bctrans_uleb128(ctx));
+	return ctx->err ? ~(MSize)0 : dflags;
+}
+
+/* Write the standard header for a dump whose main chunk has the given
+** prototype flags. Returns its length.
+*/
+static size_t bctrans_whead(uint8_t *q, MSize dflags, MSize flags)
+{
+	q[0] = BCDUMP_HEAD1;
+	q[1] = BCDUMP_HEAD2;
+	q[2] = BCDUMP_HEAD3;
+	q[3] = BCDUMP_VERSION;
+	q[4] = (uint8_t)(BCDUMP_F_STRIP | (dflags & (BCDUMP_F_BE|BCDUMP_F_FR2)) |
+		((flags & PROTO_FFI) ? BCDUMP_F_FFI : 0));
+	return 5;
+}
+
+/* Transcode an obfuscated bytecode dump into a standard stripped dump,
+** without creating any GC objects. The output is never longer than the
+** input, so an output buffer of n bytes is sufficient.
+** Returns the length of the output or 0 for a malformed dump.
+*/
+size_t lj_bctrans_mod(const char *in, size_t n, char *out)
+{
+	BCTransCtx ctx;
+	const uint8_t *pe = (const uint8_t *)in + n;
+	MSize dflags = bctrans_header(&ctx, in, n);
+	if (dflags == ~(MSize)0) return 0;
+	/* The header is written last, over the space of the input header. */
+	ctx.q = (uint8_t *)out + 5;
+	while (bctrans_record(&ctx, dflags, pe))  /* Process all prototypes. */
+		;
+	if (ctx.err || ctx.p != pe || ctx.nproto != 1) return 0;
+	*ctx.q++ = 0;
+	bctrans_whead((uint8_t *)out, dflags, ctx.flags);
+	return (size_t)(ctx.q - (uint8_t *)out);
+}
+
+/* Transcode prototype record r of an obfuscated dump, as indexed by
+** lj_bcindex_mod, into a standard record with its length prefix. out
+** needs r->ofs - r->pos + r->len bytes. Records do not depend on each
+** other, so the records of one dump may be transcoded on several threads
+** at once; children are only linked when the standard dump is read.
+** Returns the length of the output or 0 for a malformed record.
+*/
+size_t lj_bctrans_proto_mod(const char *in, size_t n, const BCProtoRec *r,
+			    char *out)
+{
+	BCTransCtx ctx;
+	MSize dflags = bctrans_header(&ctx, in, n);
+	const uint8_t *pe = (const uint8_t *)in + r->ofs + r->len;
+	if (dflags == ~(MSize)0 || r->pos >= r->ofs || (size_t)r->ofs + r->len > n)
+		return 0;
+	ctx.p = (const uint8_t *)in + r->pos;
+	ctx.q = (uint8_t *)out;
+	ctx.nproto = ~(MSize)0;  /* Children are checked by the reader. */
+	if (!bctrans_record(&ctx, dflags, pe)) return 0;
+	return (size_t)(ctx.q - (uint8_t *)out);
+}
+
+/* Write the standard header of a dump transcoded record by record. main
+** is the last record. Returns the length of the header, or 0 if the dump
+** header is malformed. out needs 5 bytes.
+*/
+size_t lj_bctrans_head_mod(const char *in, size_t n, const BCProtoRec *main,
+			   char *out)
+{
+	BCTransCtx ctx;
+	MSize dflags = bctrans_header(&ctx, in, n);
+	if (dflags == ~(MSize)0) return 0;
+	return bctrans_whead((uint8_t *)out, dflags, main->flags);
+}
+
+/* -- Format probe -------------------------------------------------------- */
+
+/* Skip a single constant key/value of a template table. */
+static void bcprobe_ktabk(BCTransCtx *ctx)
+{
+	MSize tp = bctrans_uleb128(ctx);
+	if (tp >= BCDUMP_KTAB_STR) {
+		bctrans_mem(ctx, tp - BCDUMP_KTAB_STR);
+	} else if (tp == BCDUMP_KTAB_INT) {
+		bctrans_uleb128(ctx);
+	} else if (tp == BCDUMP_KTAB_NUM) {
+		bctrans_uleb128(ctx);
+		bctrans_uleb128(ctx);
+	}
+}
+
+/* Skip the GC constants of a prototype in either layout. Stores the
+** BCDUMP_KGC_* type of each constant in kgct, unless it is NULL.
+*/
+static void bcprobe_kgc(BCTransCtx *ctx, MSize sizekgc, int obf, uint8_t *kgct)
+{
+	MSize i;
+	for (i = 0; i < sizekgc && !ctx->err; i++) {
+		MSize tp = bctrans_uleb128(ctx);
+		if (obf && (tp = bcobf_kgctype(tp)) == BCOBF_KGC_BAD) {
+			ctx->err = 1;
+			return;
+		}
+		if (kgct) kgct[i] = (uint8_t)(tp < BCDUMP_KGC_STR ? tp : BCDUMP_KGC_STR);
+		if (tp >= BCDUMP_KGC_STR) {
+			bctrans_mem(ctx, tp - BCDUMP_KGC_STR);
+		} else if (tp == BCDUMP_KGC_TAB) {
+			MSize n1 = bctrans_uleb128(ctx), n2 = bctrans_uleb128(ctx);
+			MSize n = obf && bcobf.hashfirst ? n2 + 2*n1 : n1 + 2*n2;  /* narray + 2*nhash */
+			while (n-- && !ctx->err) bcprobe_ktabk(ctx);
+		} else if (tp != BCDUMP_KGC_CHILD) {
+			MSize n = tp == BCDUMP_KGC_COMPLEX ? 4 : 2;
+			while (n--) bctrans_uleb128(ctx);
+		} else {
+			ctx->nproto++;
+		}
+	}
+}
+
+/* Check whether a prototype record parses completely in one layout. */
+static int bcprobe_layout(const uint8_t *p, MSize len, MSize dflags, int obf)
+{
+	BCTransCtx ctx;
+	const uint8_t *h, *bc;
+	MSize framesize, numparams, sizeuv, sizekn, sizekgc, nbc, sizedbg = 0, i;
+	int oop = (dflags & BCDUMP_F_BE) ? 3 : 0;
+	ctx.p = p;
+	ctx.pe = p + len;
+	ctx.q = NULL;
+	ctx.nproto = 0;
+	ctx.err = 0;
+	if (!(h = bctrans_mem(&ctx, 4))) return 0;
+	if (obf) {
+		MSize hdr[4], n1, n2;
+		bcobf_header(h, hdr);
+		framesize = hdr[BCOBF_FRAMESIZE];
+		numparams = hdr[BCOBF_NUMPARAMS];
+		sizeuv = hdr[BCOBF_SIZEUV];
+		n1 = bctrans_uleb128(&ctx);
+		n2 = bctrans_uleb128(&ctx);
+		sizekn = bcobf.knsizefirst ? n1 : n2;
+		sizekgc = bcobf.knsizefirst ? n2 : n1;
+		nbc = bctrans_uleb128(&ctx);
+		if (!(dflags & BCDUMP_F_STRIP) && bctrans_uleb128(&ctx) != 0)
+			return 0;
+	} else {
+		numparams = h[1];
+		framesize = h[2];
+		sizeuv = h[3];
+		sizekgc = bctrans_uleb128(&ctx);
+		sizekn = bctrans_uleb128(&ctx);
+		nbc = bctrans_uleb128(&ctx);
+		if (!(dflags & BCDUMP_F_STRIP) && (sizedbg = bctrans_uleb128(&ctx))) {
+			bctrans_uleb128(&ctx);
+			bctrans_uleb128(&ctx);
+		}
+	}
+	if (ctx.err || numparams > framesize || framesize > LJ_MAX_SLOTS ||
+		nbc == 0 || nbc >= LJ_MAX_BCINS ||
+		!(bc = bctrans_mem(&ctx, (size_t)nbc*4)))
+		return 0;
+	/* Every function ends with a return or a tail call. */
+	for (i = 0; i < nbc; i++)
+		if (bc[i*4 + oop] >= BC__MAX) return 0;
+	i = bc[(nbc-1)*4 + oop];
+	if (obf) i = bcobf.opmap[i];
+	if (!bc_isret((BCOp)i) && i != BC_CALLT && i != BC_CALLMT) return 0;
+	bctrans_mem(&ctx, (size_t)sizeuv*2);
+	if (obf) {
+		if (bcobf.knfirst) bctrans_knum(&ctx, sizekn);
+		bcprobe_kgc(&ctx, sizekgc, 1, NULL);
+		if (!bcobf.knfirst) bctrans_knum(&ctx, sizekn);
+	} else {
+		bcprobe_kgc(&ctx, sizekgc, 0, NULL);
+		bctrans_knum(&ctx, sizekn);
+		bctrans_mem(&ctx, sizedbg);
+	}
+	return !ctx.err && ctx.p == ctx.pe;
+}
+
+/* Return a mask of the layouts a prototype record is valid in. */
+static int bcprobe_proto(const uint8_t *p, MSize len, MSize dflags)
+{
+	return (bcprobe_layout(p, len, dflags, 1) << BCPROBE_OBFUSCATED) |
+		(bcprobe_layout(p, len, dflags, 0) << BCPROBE_STANDARD);
+}
+
+/* Classify an input buffer by its header and first prototype. A record
+** that is valid in both layouts counts as obfuscated, like in the reader.
+*/
+int lj_bcprobe_mod(const char *in, size_t n)
+{
+	BCTransCtx ctx;
+	const uint8_t *p;
+	MSize dflags, len;
+	int kinds;
+	if (n == 0) return BCPROBE_INVALID;
+	if ((uint8_t)in[0] != BCDUMP_HEAD1) return BCPROBE_SOURCE;
+	ctx.p = (const uint8_t *)in;
+	ctx.pe = ctx.p + n;
+	ctx.q = NULL;
+	ctx.nproto = 0;
+	ctx.err = 0;
+	p = bctrans_mem(&ctx, 4);
+	if (!p || p[1] != BCDUMP_HEAD2 || p[2] != BCDUMP_HEAD3 ||
+		p[3] != BCDUMP_VERSION) return BCPROBE_INVALID;
+	dflags = bctrans_uleb128(&ctx);
+	if (ctx.err || (dflags & ~(BCDUMP_F_KNOWN)) != 0) return BCPROBE_INVALID;
+	if (!(dflags & BCDUMP_F_STRIP))
+		bctrans_mem(&ctx, bctrans_uleb128(&ctx));
+	len = bctrans_uleb128(&ctx);
+	if (ctx.err || len == 0 || (size_t)(ctx.pe - ctx.p) < len)
+		return BCPROBE_INVALID;
+	kinds = bcprobe_proto(ctx.p, len, dflags);
+	if (kinds & (1 << BCPROBE_OBFUSCATED)) return BCPROBE_OBFUSCATED;
+	if (kinds & (1 << BCPROBE_STANDARD)) return BCPROBE_STANDARD;
+	return BCPROBE_INVALID;
+}
+
+/* -- Prototype index ----------------------------------------------------- */
+
+/* Parse a prototype record in one layout into its index entry. Returns
+** the stored instructions and fills kgct like bcprobe_kgc.
+*/
+static const uint8_t *bcindex_proto(BCTransCtx *ctx, BCProtoRec *r,
+				    MSize dflags, int obf, uint8_t *kgct)
+{
+	const uint8_t *bc;
+	const uint8_t *h = bctrans_mem(ctx, 4);
+	MSize sizedbg = 0;
+	if (!h) return NULL;
+	if (obf) {
+		MSize hdr[4], n1, n2;
+		bcobf_header(h, hdr);
+		r->framesize = (uint8_t)hdr[BCOBF_FRAMESIZE];
+		r->flags = (uint8_t)hdr[BCOBF_FLAGS];
+		r->numparams = (uint8_t)hdr[BCOBF_NUMPARAMS];
+		r->sizeuv = (uint8_t)hdr[BCOBF_SIZEUV];
+		n1 = bctrans_uleb128(ctx);
+		n2 = bctrans_uleb128(ctx);
+		r->sizekn = bcobf.knsizefirst ? n1 : n2;
+		r->sizekgc = bcobf.knsizefirst ? n2 : n1;
+		r->sizebc = bctrans_uleb128(ctx) + 1;
+		if (!(dflags & BCDUMP_F_STRIP) && bctrans_uleb128(ctx) != 0)
+			ctx->err = 1;
+	} else {
+		r->flags = h[0];
+		r->numparams = h[1];
+		r->framesize = h[2];
+		r->sizeuv = h[3];
+		r->sizekgc = bctrans_uleb128(ctx);
+		r->sizekn = bctrans_uleb128(ctx);
+		r->sizebc = bctrans_uleb128(ctx) + 1;
+		if (!(dflags & BCDUMP_F_STRIP) && (sizedbg = bctrans_uleb128(ctx))) {
+			bctrans_uleb128(ctx);
+			bctrans_uleb128(ctx);
+		}
+	}
+	if (ctx->err || r->sizebc >= LJ_MAX_BCINS) {
+		ctx->err = 1;
+		return NULL;
+	}
+	bc = bctrans_mem(ctx, (size_t)(r->sizebc-1)*4);
+	bctrans_mem(ctx, (size_t)r->sizeuv*2);
+	ctx->nproto = 0;
+	if (obf) {
+		if (bcobf.knfirst) bctrans_knum(ctx, r->sizekn);
+		bcprobe_kgc(ctx, r->sizekgc, 1, kgct);
+		if (!bcobf.knfirst) bctrans_knum(ctx, r->sizekn);
+	} else {
+		bcprobe_kgc(ctx, r->sizekgc, 0, kgct);
+		bctrans_knum(ctx, r->sizekn);
+		bctrans_mem(ctx, sizedbg);
+	}
+	r->nchild = ctx->nproto;
+	return bc;
+}
+
+/* Walk the prototype records of a dump. With obf < 0 the first record
+** decides the layout, like in the reader. Fills the first max entries of
+** rec and calls fn for each record, if given.
+*/
+static MSize bcindex_dump(const char *in, size_t n, int obf,
+			  BCProtoRec *rec, MSize max, BCIns *bc, uint8_t *kgct,
+			  BCScanFn fn, void *ud)
+{
+	BCTransCtx ctx;
+	const uint8_t *p, *pe = (const uint8_t *)in + n;
+	MSize dflags, count = 0, open = 0;
+	if ((uint64_t)n > LJ_MAX_MEM32) return 0;
+	ctx.p = (const uint8_t *)in;
+	ctx.pe = pe;
+	ctx.q = NULL;
+	ctx.nproto = 0;
+	ctx.err = 0;
+	p = bctrans_mem(&ctx, 4);
+	if (!p || p[0] != BCDUMP_HEAD1 || p[1] != BCDUMP_HEAD2 ||
+		p[2] != BCDUMP_HEAD3 || p[3] != BCDUMP_VERSION) return 0;
+	dflags = bctrans_uleb128(&ctx);
+	if (ctx.err || (dflags & ~(BCDUMP_F_KNOWN)) != 0) return 0;
+	if (!(dflags & BCDUMP_F_STRIP))
+		bctrans_mem(&ctx, bctrans_uleb128(&ctx));
+	for (;;) {  /* Process all prototypes in the bytecode dump. */
+		BCProtoRec r;
+		const uint8_t *pl = ctx.p, *pbc;
+		MSize len = bctrans_uleb128(&ctx);
+		if (ctx.err) return 0;
 		if (!len) break;  /* EOF */
-		bcread_need(ls, len);
-		startp = ls->p;
-		pt = (GCproto *)lj_bcread_proto_mod((int)ls);
-		if (ls->p != startp + len)
-			bcread_error(ls, LJ_ERR_BCBAD);
-		setprotoV(L, L->top, pt);
-		incr_top(L);
+		if ((size_t)(pe - ctx.p) < len) return 0;
+		if (obf < 0) {
+			int kinds = bcprobe_proto(ctx.p, len, dflags);
+			if (!kinds) return 0;
+			obf = (kinds & (1 << BCPROBE_OBFUSCATED)) != 0;
+		}
+		r.pos = (uint32_t)(pl - (const uint8_t *)in);
+		r.ofs = (uint32_t)(ctx.p - (const uint8_t *)in);
+		r.len = len;
+		ctx.pe = ctx.p + len;
+		pbc = bcindex_proto(&ctx, &r, dflags, obf, kgct);
+		if (ctx.err || ctx.p != ctx.pe || r.nchild > open) return 0;
+		ctx.pe = pe;
+		open = open - r.nchild + 1;
+		if (count < max) {
+			/* The children are the subtrees ending right before this record. */
+			MSize i;
+			r.first = count;
+			for (i = 0; i < r.nchild; i++)
+				r.first = rec[r.first-1].first;
+			rec[count] = r;
+		}
+		if (fn) {
+			int oop = (dflags & BCDUMP_F_BE) ? 3 : 0, oa = oop ? 2 : 1;
+			int oc = oop ? 1 : 2, ob = oop ? 0 : 3;
+			MSize i;
+			for (i = 0; i+1 < r.sizebc; i++, pbc += 4) {
+				uint32_t key = bcobf_inskey(i);
+				bc[i] = (BCIns)pbc[oop] | ((BCIns)(uint8_t)(pbc[oa] ^ (key >> 8)) << 8) |
+					((BCIns)(uint8_t)(pbc[oc] ^ (key >> 16)) << 16) |
+					((BCIns)(uint8_t)(pbc[ob] ^ (key >> 24)) << 24);
+			}
+			fn(ud, &r, bc, kgct);
+		}
+		count++;
 	}
-	if ((int32_t)(2 * (uint32_t)(ls->pe - ls->p)) > 0 ||
-		L->top - 1 != bcread_oldtop(L, ls))
-		bcread_error(ls, LJ_ERR_BCBAD);
-	/* Pop off last prototype. */
-	L->top--;
-	return protoV(L->top);
+	if (ctx.p != pe || open != 1) return 0;
+	return count;
+}
+
+/* Index the prototype records of a standard or obfuscated dump without
+** decoding them. Only the record lengths, the prototype headers and the
+** GC constant tags are parsed. Fills the first max entries of rec and
+** returns the number of prototypes, or 0 for a malformed dump.
+*/
+MSize lj_bcindex_mod(const char *in, size_t n, BCProtoRec *rec, MSize max)
+{
+	return bcindex_dump(in, n, -1, rec, max, NULL, NULL, NULL, NULL);
+}
+
+/* Scan every prototype of a dump in the obfuscated layout of the active
+** profile without looking at the opcodes, for recovering the opcode map
+** of a client. fn gets the instructions after FUNCF with their operands
+** decoded and the stored opcode left in place, and the BCDUMP_KGC_* type
+** of each GC constant in dump order (operand D refers to entry
+** sizekgc-1-D; every string is BCDUMP_KGC_STR). bc and kgct are scratch
+** buffers of n/4 and n entries. Returns the number of prototypes, or 0
+** if the dump does not parse.
+*/
+MSize lj_bcscan_mod(const char *in, size_t n, BCIns *bc, uint8_t *kgct,
+		    BCScanFn fn, void *ud)
+{
+	return bcindex_dump(in, n, 1, NULL, 0, bc, kgct, fn, ud);
+}
+
+/* -- Profile installation ------------------------------------------------ */
+
+/* Return a copy of the active obfuscation profile. */
+void lj_bcgetprofile_mod(BCObfProfile *pf)
+{
+	int j;
+	memcpy(pf->opmap, bcobf.opmap, BC__MAX);
+	memcpy(pf->hdr, bcobf.hdr, 4);
+	pf->hdrchain = bcobf.chain != 0;
+	pf->knsizefirst = bcobf.knsizefirst;
+	pf->knfirst = bcobf.knfirst;
+	pf->hashfirst = bcobf.hashfirst;
+	for (j = 0; j < 3; j++) {  /* A, C, B are at word bytes 1, 2, 3. */
+		int sh = j == 0 ? 8 : j == 1 ? 24 : 16;
+		pf->inskey[j] = (uint8_t)(bcobf.inskey >> sh);
+		pf->insidx[j] = (uint8_t)(bcobf.insidx >> sh);
+	}
+	pf->strkey = bcobf.strkey;
+	pf->stridx = bcobf.stridx;
+	for (j = 0; j < (int)bcobf.kgcstr; j++)
+		if (bcobf.kgcmap[j] < BCDUMP_KGC_STR) pf->kgc[bcobf.kgcmap[j]] = (uint8_t)j;
+	pf->kgcstr = bcobf.kgcstr;
+}
+
+/* Install an obfuscation profile for all dumps read from now on, or the
+** built-in profile for NULL. This also selects the string decode kernel.
+** It is not synchronized: install before any thread reads a dump.
+** Returns 0 and changes nothing if the profile is inconsistent.
+*/
+int lj_bcprofile_mod(const BCObfProfile *pf)
+{
+	uint8_t seen[BC__MAX], kgcmap[256];
+	int j;
+	if (!pf) {
+		static const uint8_t kgcdef[BCDUMP_KGC_STR] = {
+			BCDUMP_KGC_CHILD, BCDUMP_KGC_TAB, BCDUMP_KGC_I64, BCDUMP_KGC_U64,
+			BCDUMP_KGC_COMPLEX
+		};
+		bcobf.opmap = op_map;
+		bcobf.inskey = 0x0000ff00u;
+		bcobf.insidx = 0xff000000u;
+		for (j = 0; j < 4; j++) bcobf.hdr[j] = (uint8_t)j;
+		bcobf.chain = 0xff;
+		bcobf.knsizefirst = bcobf.knfirst = bcobf.hashfirst = 1;
+		bcobf.strkey = bcobf.stridx = 0xff;
+		bcobf.kgcstr = BCDUMP_KGC_STR;
+		memset(bcobf.kgcmap, 0xff, sizeof(bcobf.kgcmap));
+		memcpy(bcobf.kgcmap, kgcdef, sizeof(kgcdef));
+		strdec_kernel = strdec_select();
+		return 1;
+	}
+	/* The opcode table, header fields and GC constant codes must be
+	** permutations, and every non-string code must be below kgcstr.
+	*/
+	memset(seen, 0, sizeof(seen));
+	for (j = 0; j < BC__MAX; j++) {
+		if (pf->opmap[j] >= BC__MAX || seen[pf->opmap[j]]) return 0;
+		seen[pf->opmap[j]] = 1;
+	}
+	memset(seen, 0, 4);
+	for (j = 0; j < 4; j++) {
+		if (pf->hdr[j] > BCOBF_SIZEUV || seen[pf->hdr[j]]) return 0;
+		seen[pf->hdr[j]] = 1;
+	}
+	memset(kgcmap, 0xff, sizeof(kgcmap));
+	for (j = 0; j < BCDUMP_KGC_STR; j++) {
+		if (pf->kgc[j] >= pf->kgcstr || kgcmap[pf->kgc[j]] != 0xff) return 0;
+		kgcmap[pf->kgc[j]] = (uint8_t)j;
+	}
+	memcpy(bcobf.kgcmap, kgcmap, sizeof(kgcmap));
+	memcpy(bcobf_opmap, pf->opmap, BC__MAX);
+	bcobf.opmap = bcobf_opmap;
+	bcobf.inskey = ((uint32_t)pf->inskey[0] << 8) | ((uint32_t)pf->inskey[2] << 16) |
+		((uint32_t)pf->inskey[1] << 24);
+	bcobf.insidx = ((uint32_t)pf->insidx[0] << 8) | ((uint32_t)pf->insidx[2] << 16) |
+		((uint32_t)pf->insidx[1] << 24);
+	memcpy(bcobf.hdr, pf->hdr, 4);
+	bcobf.chain = pf->hdrchain ? 0xff : 0;
+	bcobf.knsizefirst = pf->knsizefirst != 0;
+	bcobf.knfirst = pf->knfirst != 0;
+	bcobf.hashfirst = pf->hashfirst != 0;
+	bcobf.strkey = pf->strkey;
+	bcobf.stridx = pf->stridx;
+	bcobf.kgcstr = pf->kgcstr;
+	strdec_kernel = strdec_select();
+	return 1;
 }
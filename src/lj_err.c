@@ -541,11 +541,6 @@ LJ_NOINLINE GCstr *lj_err_str(lua_State *L, ErrMsg em)
   return lj_str_newz(L, err2msg(em));
 }
 
-int lj_err_str_mod(int L, int em)
-{
-	return lj_str_new_mod(L, err2msg(em), strlen(err2msg(em)));
-}
-
 /* Out-of-memory error. */
 LJ_NOINLINE void lj_err_mem(lua_State *L)
 {
@@ -750,6 +750,26 @@ void lj_gc_fullgc(lua_State *L)
   g->vmstate = ostate;
 }
 
+/* Per-file reset for batch decoding. Collect everything a finished load left
+** behind, then grow the string table and the temp buffer back to at least
+** the hinted sizes, since a full cycle shrinks both.
+*/
+void lj_gc_reset_mod(lua_State *L, MSize strhint, MSize bufhint)
+{
+  global_State *g = G(L);
+  lj_gc_fullgc(L);
+  if (strhint > g->strmask + 1) {
+    MSize mask = g->strmask;
+    if (strhint > LJ_MAX_STRTAB/2) strhint = LJ_MAX_STRTAB/2;
+    while (mask + 1 < strhint) mask = (mask << 1) + 1;
+    lj_str_resize(L, mask);
+  }
+  if (bufhint > sbufsz(&g->tmpbuf)) {
+    lj_buf_reset(&g->tmpbuf);
+    lj_buf_tmp(L, bufhint);
+  }
+}
+
 /* -- Write barriers ------------------------------------------------------ */
 
 /* Move the GC propagation frontier forward. */
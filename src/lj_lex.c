@@ -27,7 +27,6 @@
 #include "lj_strscan.h"
 #include "lj_strfmt.h"
 
-#include "defs.h"
 
 /* Lua lexer token names. */
 static const char *const tokennames[] = {
@@ -439,111 +438,6 @@ int lj_lex_setup(lua_State *L, LexState *ls)
   return 0;
 }
 
-int lj_lex_setup_mod(int L, _DWORD *ls)
-{
-	signed int v2; // eax
-	signed int v3; // edx
-	signed int result; // eax
-	signed int v5; // eax
-	unsigned __int8 *v6; // eax
-	_BYTE *v7; // ecx
-	unsigned int v8; // ebp
-	unsigned int v9; // edi
-	_BYTE *v10; // edx
-	int v11; // eax
-	int *v12; // edx
-
-	*ls = 0;
-	ls[1] = L;
-	ls[6] = 0;
-	ls[7] = 0;
-	ls[22] = 0;
-	ls[23] = 0;
-	ls[24] = 0;
-	ls[25] = 0;
-	ls[26] = 0;
-	ls[9] = 0;
-	ls[10] = 289;
-	ls[17] = 1;
-	ls[18] = 1;
-	v2 = (int)lex_next((LexState*)ls);
-	ls[8] = v2;
-	if (v2 == 88)
-	{
-		v10 = (_BYTE *)ls[6];
-		result = 0;
-		if (*v10 == 65 && v10[1] == 78 && v10[2] == 65)
-			LABEL_14:
-		result = 1;
-	}
-	else
-	{
-		v3 = 0;
-		if (v2 != 239)
-		{
-			while (1)
-			{
-				if (v2 == 35)
-				{
-					do
-					{
-						v6 = (unsigned __int8 *)ls[6];
-						if ((unsigned int)v6 < ls[7])
-						{
-							ls[6] = (_DWORD)(v6 + 1);
-							v5 = *v6;
-							ls[8] = v5;
-						}
-						else
-						{
-							v5 = (int)lex_next((LexState*)ls);
-							ls[8] = v5;
-							if (v5 == -1)
-								return 0;
-						}
-					} while (v5 != 13 && v5 != 10);
-					lex_newline((LexState*)ls);
-					if (ls[8] != 27)
-						return 0;
-				}
-				else
-				{
-					if (v2 != 27)
-						return 0;
-					if (!v3)
-						goto LABEL_14;
-				}
-				v11 = lj_err_str_mod(L, 2972);
-				v12 = *(int **)(L + 20);
-				*(_DWORD *)(L + 20) = (_DWORD)(v12 + 2);
-				*v12 = v11;
-				v12[1] = -5;
-				lj_err_throw((lua_State*)L, 3);
-			LABEL_27:
-				v2 = (int)lex_next((LexState*)ls);
-			LABEL_20:
-				ls[8] = v2;
-				v3 = 1;
-			}
-		}
-		v7 = (_BYTE *)ls[6];
-		result = 0;
-		v8 = ls[7];
-		v9 = (unsigned int)(v7 + 2);
-		if ((unsigned int)(v7 + 2) <= v8 && *v7 == -69 && v7[1] == -65)
-		{
-			ls[6] = v9;
-			if (v9 >= v8)
-				goto LABEL_27;
-			ls[6] = (uint32_t)(v7 + 3);
-			v2 = (unsigned __int8)v7[2];
-			goto LABEL_20;
-		}
-	}
-	return result;
-}
-
-
 /* Cleanup lexer state. */
 void lj_lex_cleanup(lua_State *L, LexState *ls)
 {
@@ -23,7 +23,6 @@
 #include "lj_bcdump.h"
 #include "lj_parse.h"
 
-#include "defs.h"
 
 /* -- Load Lua source code and bytecode ----------------------------------- */
 
@@ -40,7 +39,7 @@ static TValue *cpparser(lua_State *L, lua_CFunction dummy, void *ud)
     setstrV(L, L->top++, lj_err_str(L, LJ_ERR_XMODE));
     lj_err_throw(L, LUA_ERRSYNTAX);
   }
-  pt = bc ? lj_bcread_mod(ls) : lj_parse(ls);
+  pt = bc ? lj_bcread_any_mod(ls) : lj_parse(ls);
   fn = lj_func_newL_empty(L, pt, tabref(L->env));
   /* Don't combine above/below into one statement. */
   setfuncV(L, L->top++, fn);
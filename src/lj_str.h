@@ -26,8 +26,6 @@ LJ_FUNC void lj_str_resize(lua_State *L, MSize newmask);
 LJ_FUNCA GCstr *lj_str_new(lua_State *L, const char *str, size_t len);
 LJ_FUNC void LJ_FASTCALL lj_str_free(global_State *g, GCstr *s);
 
-int lj_str_new_mod(int L, const char *str, size_t lenx);
-
 #ifdef __cplusplus
 };
 #endif
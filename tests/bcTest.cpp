@@ -0,0 +1,571 @@
+// Regression checks run by ctest, see CMakeLists.txt. Each subcommand
+// prints what failed and exits nonzero.
+//
+//   bcTest golden FIXTURE EXPECTED the fixture decodes to EXPECTED in every mode
+//   bcTest index FIXTURE EXPECTED  bcdec_index() and per-prototype decoding of the fixture
+//   bcTest malformed FIXTURE       mutated copies of a dump fail with the expected position
+//   bcTest profile                 profile text round trip
+//   bcTest pack PACK REFDIR COUNT  every pack entry equals REFDIR/<name>.lj
+//   bcTest cat OUT FILE...         concatenates the files into OUT, for the stream test
+//   bcTest truncate FILE N         keeps the first N bytes of FILE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iterator>
+
+#include "lua.h"
+
+#include "bcCore.h"
+#include "bcPack.h"
+
+
+static int g_Failures = 0;
+
+static void fail(const std::string& _what)
+{
+	fprintf(stderr, "FAIL: %s\n", _what.c_str());
+	++g_Failures;
+}
+
+static bool read_file(const std::string& _path, std::vector<char>& _out)
+{
+	std::ifstream ifs(_path.c_str(), std::ios::binary);
+	if (!ifs)
+	{
+		return false;
+	}
+	_out.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+	return true;
+}
+
+static int sink_write(void* _ud, const void* _p, size_t _n)
+{
+	((std::string*)_ud)->append((const char*)_p, _n);
+	return 0;
+}
+
+
+// EXPECTED is not decoder output: it is the stripped dump the stock
+// lj_bcwrite() wrote for the source that bcBench then obfuscated into the
+// fixture. So a bug shared by every decode mode still fails here.
+static int test_golden(const char* _fixture, const char* _expected)
+{
+	std::vector<char> dump, expected;
+	if (!read_file(_fixture, dump) || !read_file(_expected, expected))
+	{
+		fprintf(stderr, "cannot read %s or %s\n", _fixture, _expected);
+		return 1;
+	}
+
+	bcdec_ctx* ctx = bcdec_new();
+	if (!ctx)
+	{
+		fprintf(stderr, "cannot create context\n");
+		return 1;
+	}
+	static const char* const names[] = { "default", "transcode", "verify", "reset" };
+	for (int mode = 0; mode < 4; ++mode)
+	{
+		bcdec_opts opts = {};
+		opts.transcode = mode == 1;
+		opts.verify = mode == 2;
+		opts.reset = mode == 3;
+		std::string out;
+		bcdec_sink sink = {};
+		sink.write = sink_write;
+		sink.ud = &out;
+		if (bcdec_decode(ctx, dump.data(), dump.size(), &sink, &opts) != BCDEC_OK)
+		{
+			fail(std::string(names[mode]) + ": " + bcdec_errmsg(ctx));
+		}
+		else if (out.size() != expected.size() || memcmp(out.data(), expected.data(), out.size()) != 0)
+		{
+			fail(std::string(names[mode]) + ": output differs from " + _expected);
+		}
+	}
+
+	// A standard dump passes through unchanged.
+	std::string out;
+	bcdec_sink sink = {};
+	sink.write = sink_write;
+	sink.ud = &out;
+	bcdec_opts opts = {};
+	if (bcdec_probe(expected.data(), expected.size()) != BCDEC_KIND_STANDARD)
+	{
+		fail("expected dump not probed as standard");
+	}
+	else if (bcdec_decode(ctx, expected.data(), expected.size(), &sink, &opts) != BCDEC_OK ||
+		out.size() != expected.size() || memcmp(out.data(), expected.data(), out.size()) != 0)
+	{
+		fail("standard dump not passed through unchanged");
+	}
+
+	bcdec_free(ctx);
+	return g_Failures ? 1 : 0;
+}
+
+
+// Splits a standard dump into its 5 byte header and the prototype records,
+// length prefix included.
+static bool split_dump(const std::vector<char>& _dump, std::vector<std::string>& _records)
+{
+	size_t p = 5;
+	while (p < _dump.size())
+	{
+		size_t start = p, len = 0;
+		for (int shift = 0; p < _dump.size(); shift += 7)
+		{
+			unsigned char c = (unsigned char)_dump[p++];
+			len |= (size_t)(c & 0x7f) << shift;
+			if (c < 0x80)
+			{
+				break;
+			}
+		}
+		if (len == 0)
+		{
+			return p == _dump.size();
+		}
+		if (len > _dump.size() - p)
+		{
+			return false;
+		}
+		p += len;
+		_records.push_back(std::string(&_dump[start], p - start));
+	}
+	return false;
+}
+
+// The fixture's record offsets and sizes, and the subtree of each prototype.
+static const size_t g_IndexOffset[] = { 5, 238, 452, 704 };
+static const size_t g_IndexSize[] = { 233, 214, 252, 56 };
+static const size_t g_IndexFirst[] = { 0, 1, 2, 0 };
+
+// Decoding prototype k alone must give the header of the stock dump, the
+// stock records of its subtree and the terminating 0.
+static int test_index(const char* _fixture, const char* _expected)
+{
+	std::vector<char> dump, expected;
+	std::vector<std::string> records;
+	if (!read_file(_fixture, dump) || !read_file(_expected, expected) || !split_dump(expected, records))
+	{
+		fprintf(stderr, "cannot read %s or %s\n", _fixture, _expected);
+		return 1;
+	}
+
+	bcdec_proto pt[8], spt[8];
+	size_t n = bcdec_index(dump.data(), dump.size(), pt, 8);
+	size_t sn = bcdec_index(expected.data(), expected.size(), spt, 8);
+	if (n != 4 || sn != 4 || records.size() != 4)
+	{
+		fail("indexed " + std::to_string(n) + " and " + std::to_string(sn) + " prototypes, expected 4");
+		return 1;
+	}
+	if (bcdec_index(dump.data(), dump.size(), pt, 2) != 4)
+	{
+		fail("index with a short out array does not return the full count");
+	}
+	for (size_t k = 0; k < n; ++k)
+	{
+		std::string what = "proto " + std::to_string(k);
+		if (pt[k].offset != g_IndexOffset[k] || pt[k].size != g_IndexSize[k] || pt[k].first != g_IndexFirst[k] ||
+			pt[k].children != (k == 3 ? 3u : 0u))
+		{
+			fail(what + ": at " + std::to_string(pt[k].offset) + " size " + std::to_string(pt[k].size) +
+				" first " + std::to_string(pt[k].first) + " children " + std::to_string(pt[k].children));
+		}
+		if (spt[k].first != pt[k].first || spt[k].children != pt[k].children || spt[k].flags != pt[k].flags ||
+			spt[k].numparams != pt[k].numparams || spt[k].framesize != pt[k].framesize || spt[k].sizeuv != pt[k].sizeuv ||
+			spt[k].sizebc != pt[k].sizebc || spt[k].sizekgc != pt[k].sizekgc || spt[k].sizekn != pt[k].sizekn ||
+			spt[k].size != records[k].size())
+		{
+			fail(what + ": index of the standard dump differs");
+		}
+	}
+
+	bcdec_ctx* ctx = bcdec_new();
+	if (!ctx)
+	{
+		fprintf(stderr, "cannot create context\n");
+		return 1;
+	}
+	for (size_t k = 0; k < n; ++k)
+	{
+		std::string want(expected.data(), 5);
+		for (size_t i = pt[k].first; i <= k; ++i)
+		{
+			want += records[i];
+		}
+		want += '\0';
+		std::string out;
+		bcdec_sink sink = {};
+		sink.write = sink_write;
+		sink.ud = &out;
+		std::string what = "proto " + std::to_string(k);
+		if (bcdec_decode_proto(ctx, dump.data(), dump.size(), k, &sink) != BCDEC_OK)
+		{
+			fail(what + ": " + bcdec_errmsg(ctx));
+		}
+		else if (out != want)
+		{
+			fail(what + ": output differs from the stock records");
+		}
+		lua_State* L = bcdec_state(ctx);
+		if (bcdec_load_proto(ctx, dump.data(), dump.size(), k) != BCDEC_OK || !lua_isfunction(L, -1))
+		{
+			fail(what + ": not loaded as a function");
+		}
+		lua_settop(L, 0);
+	}
+	std::string out;
+	bcdec_sink sink = {};
+	sink.write = sink_write;
+	sink.ud = &out;
+	if (bcdec_decode_proto(ctx, dump.data(), dump.size(), n, &sink) == BCDEC_OK)
+	{
+		fail("prototype past the end decoded");
+	}
+
+	bcdec_free(ctx);
+	return g_Failures ? 1 : 0;
+}
+
+
+// One edit of the fixture. The fixture is bcBench -n 1 -f 3 -s 3 -k 1 -S 5:
+// the main chunk and three functions, whose records start at 5, 238, 452
+// and 704. A truncation keeps the first len bytes; otherwise len bytes from
+// at are set to val.
+struct Mutation
+{
+	const char* name;
+	bool truncate;
+	size_t at;
+	size_t len;
+	unsigned char val;
+	const char* section;  // NULL when the failure has no position.
+	size_t offset;
+};
+
+static const Mutation g_Mutations[] =
+{
+	{ "empty",            true,    0, 0, 0,    NULL,     0 },
+	{ "short magic",      true,    3, 0, 0,    NULL,     0 },
+	{ "cut in record 1",  true,  300, 0, 0,    "header", 240 },
+	{ "cut at last byte", true,  760, 0, 0,    "header", 760 },
+	{ "record length",    false,   5, 1, 0xff, "header", 7 },
+	{ "flags byte",       false,   4, 1, 0xff, "header", 7 },
+	{ "kgc overlong",     false, 309, 6, 0x80, "kgc",    309 },
+	{ "bc count",         false, 247, 1, 0xff, "bc",     303 },
+	{ "knum type",        false, 303, 1, 0xff, "knum",   303 },
+	{ "kgc in record 2",  false, 600, 6, 0x80, "kgc",    599 },
+};
+
+static void check_malformed(bcdec_ctx* _ctx, const std::vector<char>& _dump, const Mutation& _m, int _transcode)
+{
+	std::vector<char> in(_dump);
+	if (_m.truncate)
+	{
+		in.resize(_m.at);
+	}
+	else
+	{
+		memset(&in[_m.at], _m.val, _m.len);
+	}
+
+	bcdec_opts opts = {};
+	opts.transcode = _transcode;
+	std::string out;
+	bcdec_sink sink = {};
+	sink.write = sink_write;
+	sink.ud = &out;
+
+	std::string what = std::string(_m.name) + (_transcode ? " (transcode)" : "");
+	int err = bcdec_decode(_ctx, in.empty() ? NULL : in.data(), in.size(), &sink, &opts);
+	if (err != BCDEC_ERR_FORMAT)
+	{
+		fail(what + ": returned " + std::to_string(err) + ", expected BCDEC_ERR_FORMAT");
+		return;
+	}
+
+	const char* section = NULL;
+	size_t offset = 0;
+	int has_pos = bcdec_errpos(_ctx, &section, &offset);
+	if (!_m.section)
+	{
+		if (has_pos)
+		{
+			fail(what + ": unexpected position " + section + " " + std::to_string(offset));
+		}
+	}
+	else if (!has_pos)
+	{
+		fail(what + ": no position, " + bcdec_errmsg(_ctx));
+	}
+	else if (strcmp(section, _m.section) || offset != _m.offset)
+	{
+		fail(what + ": at " + section + " " + std::to_string(offset) + ", expected " + _m.section + " " + std::to_string(_m.offset));
+	}
+}
+
+static int test_malformed(const char* _fixture)
+{
+	std::vector<char> dump;
+	if (!read_file(_fixture, dump))
+	{
+		fprintf(stderr, "cannot read %s\n", _fixture);
+		return 1;
+	}
+
+	bcdec_ctx* ctx = bcdec_new();
+	if (!ctx)
+	{
+		fprintf(stderr, "cannot create context\n");
+		return 1;
+	}
+
+	// The fixture itself must decode, or every case below passes for the wrong reason.
+	bcdec_opts opts = {};
+	std::string out;
+	bcdec_sink sink = {};
+	sink.write = sink_write;
+	sink.ud = &out;
+	if (bcdec_decode(ctx, dump.data(), dump.size(), &sink, &opts) != BCDEC_OK)
+	{
+		fail(std::string("fixture: ") + bcdec_errmsg(ctx));
+	}
+
+	for (size_t i = 0; i < sizeof(g_Mutations) / sizeof(g_Mutations[0]); ++i)
+	{
+		check_malformed(ctx, dump, g_Mutations[i], 0);
+		check_malformed(ctx, dump, g_Mutations[i], 1);
+	}
+
+	bcdec_free(ctx);
+	return g_Failures ? 1 : 0;
+}
+
+
+static std::string profile_text()
+{
+	std::vector<char> buf(bcdec_profile_text(NULL, 0) + 1);
+	bcdec_profile_text(buf.data(), buf.size());
+	return buf.data();
+}
+
+static bool load_profile(const std::string& _text, std::string* _err)
+{
+	char err[256] = "";
+	int rc = bcdec_load_profile(_text.data(), _text.size(), err, sizeof(err));
+	*_err = err;
+	return rc == BCDEC_OK;
+}
+
+// Swaps the first two opcode names of the opmap line and replaces every
+// other setting with a value the built-in profile does not use.
+static std::string modified_profile(const std::string& _text)
+{
+	size_t eol = _text.find('\n');
+	std::string opmap = _text.substr(0, eol);
+	size_t a = opmap.find(' ') + 1;
+	size_t b = opmap.find(' ', a) + 1;
+	size_t c = opmap.find(' ', b);
+	std::string first = opmap.substr(a, b - 1 - a);
+	std::string second = opmap.substr(b, c - b);
+	opmap = opmap.substr(0, a) + second + ' ' + first + opmap.substr(c);
+
+	return opmap +
+		"\n# comment line\n"
+		"header sizeuv numparams flags framesize\n"
+		"chain off\n"
+		"sizes kgc kn\n"
+		"consts kgc knum\n"
+		"ktab array hash\n"
+		"ins a 17 3\n"
+		"ins b 0x22 7\n"
+		"ins c 51 0\n"
+		"string 68 15\n"
+		"kgc child 4 tab 3 i64 2 u64 1 complex 0 str 5\n";
+}
+
+static int test_profile()
+{
+	std::string err;
+	std::string builtin = profile_text();
+	if (builtin.compare(0, 6, "opmap ") != 0)
+	{
+		fail("profile text does not start with opmap: " + builtin.substr(0, 40));
+		return 1;
+	}
+
+	if (!load_profile(builtin, &err))
+	{
+		fail("built-in profile text rejected: " + err);
+	}
+	else if (profile_text() != builtin)
+	{
+		fail("built-in profile changed by its own text");
+	}
+
+	std::string modified = modified_profile(builtin);
+	if (!load_profile(modified, &err))
+	{
+		fail("modified profile rejected: " + err);
+	}
+	else
+	{
+		std::string text = profile_text();
+		if (text == builtin)
+		{
+			fail("modified profile not applied");
+		}
+		if (text.find("\nchain off\n") == std::string::npos || text.find("\nins b 34 7\n") == std::string::npos ||
+			text.find("\nkgc child 4 tab 3 i64 2 u64 1 complex 0 str 5\n") == std::string::npos)
+		{
+			fail("modified profile text is missing settings:\n" + text);
+		}
+		if (!load_profile(text, &err))
+		{
+			fail("modified profile text rejected: " + err);
+		}
+		else if (profile_text() != text)
+		{
+			fail("modified profile text does not round trip:\n" + text + "---\n" + profile_text());
+		}
+	}
+
+	// A bad profile leaves the active one alone.
+	std::string active = profile_text();
+	std::string dup = builtin;
+	size_t a = dup.find(' ') + 1;
+	size_t b = dup.find(' ', a) + 1;
+	size_t c = dup.find(' ', b);
+	dup.replace(b, c - b, dup.substr(a, b - 1 - a));
+	if (load_profile(dup, &err))
+	{
+		fail("profile with a duplicate opcode accepted");
+	}
+	else if (err.empty())
+	{
+		fail("profile with a duplicate opcode rejected without a message");
+	}
+	if (profile_text() != active)
+	{
+		fail("rejected profile changed the active one");
+	}
+
+	if (bcdec_load_profile(NULL, 0, NULL, 0) != BCDEC_OK || profile_text() != builtin)
+	{
+		fail("NULL does not restore the built-in profile");
+	}
+	return g_Failures ? 1 : 0;
+}
+
+
+static int test_pack(const char* _pack, const std::string& _refdir, unsigned _count)
+{
+	BCPackReader reader;
+	if (!reader.open(_pack))
+	{
+		fprintf(stderr, "cannot open pack %s\n", _pack);
+		return 1;
+	}
+
+	const std::vector<BCPackEntry>& entries = reader.list();
+	if (entries.size() != _count)
+	{
+		fail("pack has " + std::to_string(entries.size()) + " entries, expected " + std::to_string(_count));
+	}
+	for (const BCPackEntry& e : entries)
+	{
+		std::vector<char> data, ref;
+		if (!reader.read(e, data))
+		{
+			fail(e.name + ": damaged in pack");
+		}
+		else if (!read_file(_refdir + "/" + e.name + ".lj", ref))
+		{
+			fail(e.name + ": no reference output");
+		}
+		else if (data != ref)
+		{
+			fail(e.name + ": differs from the reference output");
+		}
+	}
+	return g_Failures ? 1 : 0;
+}
+
+
+static int cat_files(const char* _out, int _count, char** _files)
+{
+	std::ofstream ofs(_out, std::ios::binary);
+	for (int i = 0; i < _count; ++i)
+	{
+		std::vector<char> data;
+		if (!read_file(_files[i], data))
+		{
+			fprintf(stderr, "cannot read %s\n", _files[i]);
+			return 1;
+		}
+		ofs.write(data.data(), (std::streamsize)data.size());
+	}
+	ofs.close();
+	if (!ofs)
+	{
+		fprintf(stderr, "cannot write %s\n", _out);
+		return 1;
+	}
+	return 0;
+}
+
+static int truncate_file(const char* _path, size_t _size)
+{
+	std::vector<char> data;
+	if (!read_file(_path, data) || data.size() < _size)
+	{
+		fprintf(stderr, "cannot read %zu bytes of %s\n", _size, _path);
+		return 1;
+	}
+	std::ofstream ofs(_path, std::ios::binary | std::ios::trunc);
+	ofs.write(data.data(), (std::streamsize)_size);
+	ofs.close();
+	return ofs ? 0 : 1;
+}
+
+
+int main(int _argc, char** _argv)
+{
+	std::string cmd = _argc > 1 ? _argv[1] : "";
+	if (cmd == "golden" && _argc == 4)
+	{
+		return test_golden(_argv[2], _argv[3]);
+	}
+	if (cmd == "index" && _argc == 4)
+	{
+		return test_index(_argv[2], _argv[3]);
+	}
+	if (cmd == "malformed" && _argc == 3)
+	{
+		return test_malformed(_argv[2]);
+	}
+	if (cmd == "profile" && _argc == 2)
+	{
+		return test_profile();
+	}
+	if (cmd == "pack" && _argc == 5)
+	{
+		return test_pack(_argv[2], _argv[3], (unsigned)strtoul(_argv[4], NULL, 10));
+	}
+	if (cmd == "cat" && _argc >= 3)
+	{
+		return cat_files(_argv[2], _argc - 3, _argv + 3);
+	}
+	if (cmd == "truncate" && _argc == 4)
+	{
+		return truncate_file(_argv[2], (size_t)strtoul(_argv[3], NULL, 10));
+	}
+	fprintf(stderr, "usage: bcTest golden FIXTURE EXPECTED | index FIXTURE EXPECTED | malformed FIXTURE | profile | pack PACK REFDIR COUNT | cat OUT FILE... | truncate FILE N\n");
+	return 1;
+}
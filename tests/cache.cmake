@@ -0,0 +1,43 @@
+# --cache on a bcBench corpus: misses store entries, hits link them, -t has
+# its own entries, two processes can share one cache, and rewriting a
+# linked output leaves its entry intact. Run by ctest, see CMakeLists.txt.
+
+include(${CMAKE_CURRENT_LIST_DIR}/common.cmake)
+
+set(in ${WORK}/in)
+set(cache ${WORK}/cache)
+run(${BCBENCH} -n 5 -f 3 -S 9 -o ${in})
+run(${BCDEC} ${in} ${WORK}/ref)
+
+expect(0 "cache    : 0 hits, 5 misses, 5 stored, 5 outputs linked" ${BCDEC} --cache ${cache} ${in} ${WORK}/miss)
+expect(0 "cache    : 5 hits, 0 misses, 0 stored, 5 outputs linked" ${BCDEC} --cache ${cache} ${in} ${WORK}/hit)
+compare("--cache miss" ${WORK}/ref ${WORK}/miss)
+compare("--cache hit" ${WORK}/ref ${WORK}/hit)
+expect(0 "cache    : 0 hits, 5 misses, 5 stored" ${BCDEC} -t --cache ${cache} ${in} ${WORK}/t)
+compare("-t --cache" ${WORK}/ref ${WORK}/t)
+
+expect(0 "cache    : 5 hits, 0 misses" ${BCDEC} -p ${WORK}/out.pack --cache ${cache} ${in})
+run(${BCTEST} pack ${WORK}/out.pack ${WORK}/ref 5)
+
+# Decoding over linked outputs without the cache replaces the files, so
+# the entries they were linked to keep their bytes.
+run(${BCDEC} -t ${in} ${WORK}/hit)
+expect(0 "cache    : 5 hits" ${BCDEC} --cache ${cache} ${in} ${WORK}/again)
+compare("--cache after rewriting its links" ${WORK}/ref ${WORK}/again)
+
+# Two processes filling one empty cache at the same time.
+execute_process(
+	COMMAND ${BCDEC} -j 2 --cache ${WORK}/shared ${in} ${WORK}/p1
+	COMMAND ${BCDEC} -j 2 --cache ${WORK}/shared ${in} ${WORK}/p2
+	RESULTS_VARIABLE rcs OUTPUT_QUIET ERROR_VARIABLE err)
+if(NOT rcs STREQUAL "0;0")
+	message(FATAL_ERROR "concurrent --cache runs exited with ${rcs}:\n${err}")
+endif()
+compare("concurrent --cache 1" ${WORK}/ref ${WORK}/p1)
+compare("concurrent --cache 2" ${WORK}/ref ${WORK}/p2)
+file(GLOB_RECURSE entries ${WORK}/shared/*.lj)
+list(LENGTH entries count)
+if(NOT count EQUAL 5)
+	message(FATAL_ERROR "concurrent --cache runs left ${count} entries, expected 5")
+endif()
+expect(0 "cache    : 5 hits, 0 misses" ${BCDEC} --cache ${WORK}/shared ${in} ${WORK}/p3)
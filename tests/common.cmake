@@ -0,0 +1,51 @@
+# Helpers shared by the test scripts. Each script gets the tool paths and
+# a scratch directory, WORK, that is emptied first.
+
+foreach(var BCDEC BCBENCH BCTEST WORK)
+	if(NOT ${var})
+		message(FATAL_ERROR "${var} is not set")
+	endif()
+endforeach()
+
+file(REMOVE_RECURSE ${WORK})
+file(MAKE_DIRECTORY ${WORK})
+
+function(run)
+	execute_process(COMMAND ${ARGN} RESULT_VARIABLE rc OUTPUT_VARIABLE out ERROR_VARIABLE out)
+	if(NOT rc EQUAL 0)
+		string(REPLACE ";" " " cmd "${ARGN}")
+		message(FATAL_ERROR "${cmd} exited with ${rc}:\n${out}")
+	endif()
+endfunction()
+
+# Runs a command that must exit with RC and print output matching REGEX,
+# stdout and stderr together.
+function(expect rc regex)
+	execute_process(COMMAND ${ARGN} RESULT_VARIABLE got OUTPUT_VARIABLE out ERROR_VARIABLE out)
+	string(REPLACE ";" " " cmd "${ARGN}")
+	if(NOT got EQUAL rc)
+		message(FATAL_ERROR "${cmd} exited with ${got}, expected ${rc}:\n${out}")
+	endif()
+	if(NOT out MATCHES "${regex}")
+		message(FATAL_ERROR "${cmd} did not print \"${regex}\":\n${out}")
+	endif()
+endfunction()
+
+# Every .lj under REF must have an identical file under DIR, and no more.
+function(compare what ref dir)
+	string(REPLACE ";" " " what "${what}")
+	file(GLOB_RECURSE ref_files RELATIVE ${ref} ${ref}/*.lj)
+	file(GLOB_RECURSE dir_files RELATIVE ${dir} ${dir}/*.lj)
+	list(LENGTH ref_files ref_count)
+	list(LENGTH dir_files dir_count)
+	if(ref_count EQUAL 0 OR NOT ref_count EQUAL dir_count)
+		message(FATAL_ERROR "${what}: ${dir_count} outputs, expected ${ref_count}")
+	endif()
+	foreach(f ${ref_files})
+		execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${ref}/${f} ${dir}/${f} RESULT_VARIABLE rc)
+		if(NOT rc EQUAL 0)
+			message(FATAL_ERROR "${what}: ${f} differs from ${ref}")
+		endif()
+	endforeach()
+	message(STATUS "${what}: ${ref_count} outputs match")
+endfunction()
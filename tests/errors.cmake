@@ -0,0 +1,42 @@
+# Failures in a batch: a truncated and an empty input are reported with
+# their reason and position, the other files are still decoded and the
+# exit status is 1. Usage errors exit 1 as well. Run by ctest, see
+# CMakeLists.txt.
+
+include(${CMAKE_CURRENT_LIST_DIR}/common.cmake)
+
+set(in ${WORK}/in)
+run(${BCBENCH} -n 3 -f 3 -S 4 -o ${in})
+run(${BCTEST} truncate ${in}/bench_00001.lua.bytes 300)
+file(WRITE ${in}/empty.lua.bytes "")
+
+foreach(args "" "-t" "-a;-j;2")
+	set(out ${WORK}/out)
+	file(REMOVE_RECURSE ${out})
+	expect(1 "bench_00001.lua.bytes: cannot load malformed bytecode \\(header at offset 7\\)"
+		${BCDEC} ${args} --stats ${WORK}/stats.json ${in} ${out})
+	expect(1 "empty.lua.bytes: empty input" ${BCDEC} ${args} ${in} ${out})
+	foreach(f bench_00000.lj bench_00002.lj)
+		if(NOT EXISTS ${out}/${f})
+			message(FATAL_ERROR "${args}: ${f} not decoded after another file failed")
+		endif()
+	endforeach()
+	file(STRINGS ${WORK}/stats.json failed REGEX "\"status\":\"failed\"")
+	if(NOT failed MATCHES "\"file\":\"bench_00001.lua.bytes\",\"error\":\"[^\"]*\",\"section\":\"header\",\"offset\":7,")
+		message(FATAL_ERROR "${args}: --stats line of the failed file:\n${failed}")
+	endif()
+endforeach()
+
+# A valid batch exits 0.
+file(REMOVE ${in}/bench_00001.lua.bytes ${in}/empty.lua.bytes)
+run(${BCDEC} ${in} ${WORK}/clean)
+
+foreach(option -p --strings --pool --profile --recover-opmap --cache --stats)
+	expect(1 "missing value for ${option}" ${BCDEC} ${in} ${option})
+endforeach()
+expect(1 "missing value for --cache" ${BCDEC} --cache -t ${in} ${WORK}/out)
+foreach(option -j -s -b)
+	expect(1 "${option} takes a positive number" ${BCDEC} ${option} 0 ${in})
+	expect(1 "${option} takes a positive number" ${BCDEC} ${in} ${option})
+endforeach()
+expect(1 "Usage: bcDec" ${BCDEC})
@@ -0,0 +1,42 @@
+# -i on a bcBench corpus: a second run skips every file, a touched output
+# or a restored input is decoded again, a vanished input loses its output
+# and an input that cannot be read keeps it. Run by ctest, see CMakeLists.txt.
+
+include(${CMAKE_CURRENT_LIST_DIR}/common.cmake)
+
+set(in ${WORK}/in)
+run(${BCBENCH} -n 6 -f 3 -S 2 -o ${in})
+run(${BCDEC} ${in} ${WORK}/ref)
+
+foreach(args "" "-a;-j;2")
+	set(out ${WORK}/out)
+	file(REMOVE_RECURSE ${out} ${out}.manifest)
+	expect(0 "incremental: 6 decoded, 0 unchanged, 0 removed" ${BCDEC} -i ${args} ${in} ${out})
+	expect(0 "incremental: 0 decoded, 6 unchanged, 0 removed" ${BCDEC} -i ${args} ${in} ${out})
+	compare("-i ${args}" ${WORK}/ref ${out})
+
+	# Only the size and mtime of an output are checked, not its contents.
+	file(TOUCH ${out}/bench_00001.lj)
+	expect(0 "incremental: 1 decoded, 5 unchanged, 0 removed" ${BCDEC} -i ${args} ${in} ${out})
+
+	if(NOT WIN32)
+		file(RENAME ${in}/bench_00002.lua.bytes ${WORK}/saved)
+		execute_process(COMMAND ${CMAKE_COMMAND} -E create_symlink ${WORK}/missing ${in}/bench_00002.lua.bytes)
+		expect(1 "bench_00002.lua.bytes: cannot read input" ${BCDEC} -i ${args} ${in} ${out})
+		if(NOT EXISTS ${out}/bench_00002.lj)
+			message(FATAL_ERROR "-i ${args}: the output of an unreadable input was deleted")
+		endif()
+		file(REMOVE ${in}/bench_00002.lua.bytes)
+		file(RENAME ${WORK}/saved ${in}/bench_00002.lua.bytes)
+		expect(0 "incremental: 1 decoded, 5 unchanged, 0 removed" ${BCDEC} -i ${args} ${in} ${out})
+	endif()
+
+	file(RENAME ${in}/bench_00003.lua.bytes ${WORK}/saved)
+	expect(0 "incremental: 0 decoded, 5 unchanged, 1 removed" ${BCDEC} -i ${args} ${in} ${out})
+	if(EXISTS ${out}/bench_00003.lj)
+		message(FATAL_ERROR "-i ${args}: the output of a vanished input was kept")
+	endif()
+	file(RENAME ${WORK}/saved ${in}/bench_00003.lua.bytes)
+	expect(0 "incremental: 1 decoded, 5 unchanged, 0 removed" ${BCDEC} -i ${args} ${in} ${out})
+	compare("-i ${args} after changes" ${WORK}/ref ${out})
+endforeach()
@@ -0,0 +1,19 @@
+# --list and --proto on the golden fixture. Run by ctest, see CMakeLists.txt.
+
+include(${CMAKE_CURRENT_LIST_DIR}/common.cmake)
+
+set(fixture ${CMAKE_CURRENT_LIST_DIR}/data/bench_small.lua.bytes)
+expect(0 "\n +3 +0 +3 +0 +2 +0 +10 +6 +0 +704 +56 +0x03 +main\n4 prototypes indexed" ${BCDEC} --list ${fixture})
+
+# The main chunk spans every prototype, so alone it is the whole dump.
+run(${BCDEC} --proto 3 ${fixture} ${WORK})
+execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${WORK}/bench_small.3.lj
+	${CMAKE_CURRENT_LIST_DIR}/data/bench_small.lj RESULT_VARIABLE rc)
+if(NOT rc EQUAL 0)
+	message(FATAL_ERROR "--proto 3: output differs from the lj_bcwrite dump")
+endif()
+run(${BCDEC} --proto 1 ${fixture} ${WORK})
+run(${BCDEC} --list ${WORK}/bench_small.1.lj)
+
+expect(1 "no such prototype" ${BCDEC} --proto 4 ${fixture} ${WORK})
+expect(1 "--proto takes a prototype number" ${BCDEC} --proto x ${fixture} ${WORK})
@@ -0,0 +1,94 @@
+# Decodes bcBench corpora in every bcDec mode and compares the outputs byte
+# for byte with the default mode, whose output for the golden fixture is
+# checked against lj_bcwrite first. Run by ctest, see CMakeLists.txt:
+#   cmake -DBCDEC=... -DBCBENCH=... -DBCTEST=... -DWORK=dir -P modes.cmake
+
+include(${CMAKE_CURRENT_LIST_DIR}/common.cmake)
+
+# Small functions with template tables, stripped and with debug sections,
+# and one dump above the 1 MB threshold of the parallel single-file path.
+run(${BCBENCH} -n 30 -f 6 -k 3 -S 7 -o ${WORK}/corpus)
+run(${BCBENCH} -n 10 -f 4 -k 2 -S 11 -g -o ${WORK}/corpus/debug)
+run(${BCBENCH} -n 1 -f 2500 -S 3 -o ${WORK}/big)
+
+set(corpus ${WORK}/corpus)
+file(COPY ${CMAKE_CURRENT_LIST_DIR}/data/bench_small.lua.bytes DESTINATION ${corpus}/golden)
+run(${BCDEC} ${corpus} ${WORK}/ref)
+
+# The default mode itself is checked against the stock lj_bcwrite dump of
+# the fixture, so a bug every mode shares does not pass as a match.
+execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${WORK}/ref/golden/bench_small.lj
+	${CMAKE_CURRENT_LIST_DIR}/data/bench_small.lj RESULT_VARIABLE rc)
+if(NOT rc EQUAL 0)
+	message(FATAL_ERROR "default mode: bench_small.lj differs from the lj_bcwrite dump")
+endif()
+
+foreach(mode t j3 a u r v)
+	if(mode STREQUAL "t")
+		set(args -t)
+	elseif(mode STREQUAL "j3")
+		set(args -j 3)
+	elseif(mode STREQUAL "a")
+		set(args -a -j 2)
+	elseif(mode STREQUAL "u")
+		set(args -u -j 2)
+	elseif(mode STREQUAL "r")
+		set(args -r -s 64 -b 4096)
+	else()
+		set(args --verify)
+	endif()
+	run(${BCDEC} ${args} ${corpus} ${WORK}/out_${mode})
+	compare("${args}" ${WORK}/ref ${WORK}/out_${mode})
+endforeach()
+
+# The second -i run skips every file and must leave the outputs as they are.
+run(${BCDEC} -i ${corpus} ${WORK}/out_i)
+run(${BCDEC} -i ${corpus} ${WORK}/out_i)
+compare("-i" ${WORK}/ref ${WORK}/out_i)
+
+# The second --cache run is all hits.
+run(${BCDEC} --cache ${WORK}/cache ${corpus} ${WORK}/out_c1)
+run(${BCDEC} --cache ${WORK}/cache ${corpus} ${WORK}/out_c2)
+compare("--cache miss" ${WORK}/ref ${WORK}/out_c1)
+compare("--cache hit" ${WORK}/ref ${WORK}/out_c2)
+
+file(GLOB_RECURSE inputs RELATIVE ${corpus} ${corpus}/*.lua.bytes)
+list(SORT inputs)
+list(LENGTH inputs input_count)
+
+run(${BCDEC} -p ${WORK}/out.pack ${corpus})
+run(${BCTEST} pack ${WORK}/out.pack ${WORK}/ref ${input_count})
+message(STATUS "-p: ${input_count} modules match")
+
+# Single files, and all inputs concatenated through stdin.
+set(stream_in)
+set(stream_ref)
+foreach(f ${inputs})
+	string(REGEX REPLACE "\\.lua\\.bytes$" ".lj" lj ${f})
+	get_filename_component(dir ${lj} DIRECTORY)
+	run(${BCDEC} ${corpus}/${f} ${WORK}/out_single/${dir})
+	list(APPEND stream_in ${corpus}/${f})
+	list(APPEND stream_ref ${WORK}/ref/${lj})
+endforeach()
+compare("single file" ${WORK}/ref ${WORK}/out_single)
+
+run(${BCTEST} cat ${WORK}/stream.in ${stream_in})
+run(${BCTEST} cat ${WORK}/stream.ref ${stream_ref})
+foreach(args "" "-t")
+	execute_process(COMMAND ${BCDEC} ${args} - INPUT_FILE ${WORK}/stream.in OUTPUT_FILE ${WORK}/stream.out
+		RESULT_VARIABLE rc ERROR_VARIABLE out)
+	execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${WORK}/stream.ref ${WORK}/stream.out RESULT_VARIABLE diff)
+	if(NOT rc EQUAL 0 OR NOT diff EQUAL 0)
+		message(FATAL_ERROR "stream ${args}: exit ${rc}, compare ${diff}:\n${out}")
+	endif()
+	message(STATUS "stream ${args}: ${input_count} dumps match")
+endforeach()
+
+# The large dump through the parallel path, plain and transcoded.
+file(GLOB big RELATIVE ${WORK}/big ${WORK}/big/*.lua.bytes)
+run(${BCDEC} ${WORK}/big/${big} ${WORK}/big_ref)
+foreach(args "-j;4" "-t;-j;4")
+	run(${BCDEC} ${args} ${WORK}/big/${big} ${WORK}/big_out)
+	compare("single file ${args}" ${WORK}/big_ref ${WORK}/big_out)
+	file(REMOVE_RECURSE ${WORK}/big_out)
+endforeach()
@@ -0,0 +1,35 @@
+# --print-profile and --profile: the printed built-in profile decodes the
+# golden fixture to the stock dump, a changed profile is applied, a bad one
+# is rejected with its line, and -i decodes again when the profile changes.
+# Run by ctest, see CMakeLists.txt.
+
+include(${CMAKE_CURRENT_LIST_DIR}/common.cmake)
+
+set(fixture ${CMAKE_CURRENT_LIST_DIR}/data/bench_small.lua.bytes)
+execute_process(COMMAND ${BCDEC} --print-profile OUTPUT_FILE ${WORK}/builtin.prof RESULT_VARIABLE rc)
+if(NOT rc EQUAL 0)
+	message(FATAL_ERROR "--print-profile exited with ${rc}")
+endif()
+expect(0 "\nchain on\n" ${BCDEC} --profile ${WORK}/builtin.prof --print-profile)
+
+run(${BCDEC} --profile ${WORK}/builtin.prof ${fixture} ${WORK}/out)
+execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${WORK}/out/bench_small.lj
+	${CMAKE_CURRENT_LIST_DIR}/data/bench_small.lj RESULT_VARIABLE rc)
+if(NOT rc EQUAL 0)
+	message(FATAL_ERROR "--profile with the built-in profile: output differs from the lj_bcwrite dump")
+endif()
+
+# The fixture does not chain its header bytes under this profile.
+file(WRITE ${WORK}/nochain.prof "# header bytes stored plain\nchain off\n")
+expect(0 "\nchain off\n" ${BCDEC} --profile ${WORK}/nochain.prof --print-profile)
+expect(1 "cannot load malformed bytecode" ${BCDEC} --profile ${WORK}/nochain.prof ${fixture} ${WORK}/out)
+
+file(WRITE ${WORK}/bad.prof "chain on\nsizes kn kn\n")
+expect(1 "bad.prof: line 2: " ${BCDEC} --profile ${WORK}/bad.prof ${fixture} ${WORK}/out)
+expect(1 "Cannot read profile" ${BCDEC} --profile ${WORK}/missing.prof ${fixture} ${WORK}/out)
+
+file(MAKE_DIRECTORY ${WORK}/in)
+file(COPY ${fixture} DESTINATION ${WORK}/in)
+expect(0 "incremental: 1 decoded" ${BCDEC} -i ${WORK}/in ${WORK}/inc)
+expect(0 "incremental: 0 decoded, 1 unchanged" ${BCDEC} -i ${WORK}/in ${WORK}/inc)
+expect(0 "incremental: 1 decoded" ${BCDEC} -i --profile ${WORK}/builtin.prof ${WORK}/in ${WORK}/inc)